@@ -2,32 +2,33 @@
 
 #include "ECFCustomTimelineBP.h"
 #include "EnhancedCodeFlow.h"
+#include "CodeFlowActions/ECFCustomTimeline.h"
 
 ECF_PRAGMA_DISABLE_OPTIMIZATION
 
-UECFCustomTimelineBP* UECFCustomTimelineBP::ECFCustomTimeline(const UObject* WorldContextObject, UCurveFloat* CurveFloat, FECFActionSettings Settings, FECFHandleBP& Handle)
+UECFCustomTimelineBP* UECFCustomTimelineBP::ECFCustomTimeline(const UObject* WorldContextObject, UCurveFloat* CurveFloat, FECFActionSettings Settings, FECFHandleBP& Handle, float TickEventInterval /*= 0.f*/)
 {
-	UECFCustomTimelineBP* Proxy = NewObject<UECFCustomTimelineBP>();
+	UECFCustomTimelineBP* Proxy = CreateProxy<UECFCustomTimelineBP>(WorldContextObject);
 	if (Proxy)
 	{
 		Proxy->Init(WorldContextObject, Settings);
-		Proxy->Proxy_Handle = FFlow::AddCustomTimeline(WorldContextObject, CurveFloat,
-			[Proxy](float Value, float Time)
+		Proxy->Proxy_TickEventInterval = TickEventInterval;
+		Proxy->StartProxyAction<UECFCustomTimeline>(Settings, FECFInstanceId(), CurveFloat,
+			[Proxy, ProxyGeneration = Proxy->Proxy_Generation](float Value, float Time)
 			{
-				if (IsProxyValid(Proxy))
+				if (IsProxyValid(Proxy, ProxyGeneration) && Proxy->ShouldBroadcastTimelineTick(Time))
 				{
 					Proxy->OnTick.Broadcast(Value, Time, false);
 				}
 			},
-			[Proxy](float Value, float Time, bool bStopped)
+			[Proxy, ProxyGeneration = Proxy->Proxy_Generation](float Value, float Time, bool bStopped)
 			{
-				if (IsProxyValid(Proxy))
+				if (IsProxyValid(Proxy, ProxyGeneration))
 				{
 					Proxy->OnFinished.Broadcast(Value, Time, bStopped);
 					Proxy->ClearAsyncBPAction();
 				}
-			},
-		Settings);
+			});
 		Handle = FECFHandleBP(Proxy->Proxy_Handle);
 	}
 
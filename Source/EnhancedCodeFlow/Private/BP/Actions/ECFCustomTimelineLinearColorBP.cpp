@@ -2,32 +2,33 @@
 
 #include "ECFCustomTimelineLinearColorBP.h"
 #include "EnhancedCodeFlow.h"
+#include "CodeFlowActions/ECFCustomTimelineLinearColor.h"
 
 ECF_PRAGMA_DISABLE_OPTIMIZATION
 
-UECFCustomTimelineLinearColorBP* UECFCustomTimelineLinearColorBP::ECFCustomTimelineLinearColor(const UObject* WorldContextObject, UCurveLinearColor* CurveLinearColor, FECFActionSettings Settings, FECFHandleBP& Handle)
+UECFCustomTimelineLinearColorBP* UECFCustomTimelineLinearColorBP::ECFCustomTimelineLinearColor(const UObject* WorldContextObject, UCurveLinearColor* CurveLinearColor, FECFActionSettings Settings, FECFHandleBP& Handle, float TickEventInterval /*= 0.f*/)
 {
-	UECFCustomTimelineLinearColorBP* Proxy = NewObject<UECFCustomTimelineLinearColorBP>();
+	UECFCustomTimelineLinearColorBP* Proxy = CreateProxy<UECFCustomTimelineLinearColorBP>(WorldContextObject);
 	if (Proxy)
 	{
 		Proxy->Init(WorldContextObject, Settings);
-		Proxy->Proxy_Handle = FFlow::AddCustomTimelineLinearColor(WorldContextObject, CurveLinearColor,
-			[Proxy](FLinearColor Value, float Time)
+		Proxy->Proxy_TickEventInterval = TickEventInterval;
+		Proxy->StartProxyAction<UECFCustomTimelineLinearColor>(Settings, FECFInstanceId(), CurveLinearColor,
+			[Proxy, ProxyGeneration = Proxy->Proxy_Generation](FLinearColor Value, float Time)
 			{
-				if (IsProxyValid(Proxy))
+				if (IsProxyValid(Proxy, ProxyGeneration) && Proxy->ShouldBroadcastTimelineTick(Time))
 				{
 					Proxy->OnTick.Broadcast(Value, Time, false);
 				}
 			},
-			[Proxy](FLinearColor Value, float Time, bool bStopped)
+			[Proxy, ProxyGeneration = Proxy->Proxy_Generation](FLinearColor Value, float Time, bool bStopped)
 			{
-				if (IsProxyValid(Proxy))
+				if (IsProxyValid(Proxy, ProxyGeneration))
 				{
 					Proxy->OnFinished.Broadcast(Value, Time, bStopped);
 					Proxy->ClearAsyncBPAction();
 				}
-			},
-		Settings);
+			});
 		Handle = FECFHandleBP(Proxy->Proxy_Handle);
 	}
 
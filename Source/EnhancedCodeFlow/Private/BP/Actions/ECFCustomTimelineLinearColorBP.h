@@ -20,6 +20,10 @@ public:
 	UPROPERTY(BlueprintAssignable)
 	FOnECFCustomTimelineLinearColorBPEvent OnFinished;
 	
-	UFUNCTION(BlueprintCallable, meta = (BlueprintInternalUseOnly = "true", WorldContext = "WorldContextObject", AdvancedDisplay = "Settings", ToolTip = "Adds a custom timeline defined by a float curve.", DisplayName = "ECF - Custom Timeline LinearColor"), Category = "ECF")
-	static UECFCustomTimelineLinearColorBP* ECFCustomTimelineLinearColor(const UObject* WorldContextObject, class UCurveLinearColor* CurveLinearColor, FECFActionSettings Settings, FECFHandleBP& Handle);
+	UFUNCTION(BlueprintCallable, meta = (BlueprintInternalUseOnly = "true", WorldContext = "WorldContextObject", AdvancedDisplay = "Settings, TickEventInterval", ToolTip = "Adds a custom timeline defined by a float curve.\nTickEventInterval limits how often OnTick is called. If 0, it is called on every tick.", DisplayName = "ECF - Custom Timeline LinearColor"), Category = "ECF")
+	static UECFCustomTimelineLinearColorBP* ECFCustomTimelineLinearColor(const UObject* WorldContextObject, class UCurveLinearColor* CurveLinearColor, FECFActionSettings Settings, FECFHandleBP& Handle, float TickEventInterval = 0.f);
+
+protected:
+
+	bool IsTickEventBound() const override { return OnTick.IsBound(); }
 };
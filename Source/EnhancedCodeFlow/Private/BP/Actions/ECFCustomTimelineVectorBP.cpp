@@ -2,32 +2,33 @@
 
 #include "ECFCustomTimelineVectorBP.h"
 #include "EnhancedCodeFlow.h"
+#include "CodeFlowActions/ECFCustomTimelineVector.h"
 
 ECF_PRAGMA_DISABLE_OPTIMIZATION
 
-UECFCustomTimelineVectorBP* UECFCustomTimelineVectorBP::ECFCustomTimelineVector(const UObject* WorldContextObject, UCurveVector* CurveVector, FECFActionSettings Settings, FECFHandleBP& Handle)
+UECFCustomTimelineVectorBP* UECFCustomTimelineVectorBP::ECFCustomTimelineVector(const UObject* WorldContextObject, UCurveVector* CurveVector, FECFActionSettings Settings, FECFHandleBP& Handle, float TickEventInterval /*= 0.f*/)
 {
-	UECFCustomTimelineVectorBP* Proxy = NewObject<UECFCustomTimelineVectorBP>();
+	UECFCustomTimelineVectorBP* Proxy = CreateProxy<UECFCustomTimelineVectorBP>(WorldContextObject);
 	if (Proxy)
 	{
 		Proxy->Init(WorldContextObject, Settings);
-		Proxy->Proxy_Handle = FFlow::AddCustomTimelineVector(WorldContextObject, CurveVector,
-			[Proxy](FVector Value, float Time)
+		Proxy->Proxy_TickEventInterval = TickEventInterval;
+		Proxy->StartProxyAction<UECFCustomTimelineVector>(Settings, FECFInstanceId(), CurveVector,
+			[Proxy, ProxyGeneration = Proxy->Proxy_Generation](FVector Value, float Time)
 			{
-				if (IsProxyValid(Proxy))
+				if (IsProxyValid(Proxy, ProxyGeneration) && Proxy->ShouldBroadcastTimelineTick(Time))
 				{
 					Proxy->OnTick.Broadcast(Value, Time, false);
 				}
 			},
-			[Proxy](FVector Value, float Time, bool bStopped)
+			[Proxy, ProxyGeneration = Proxy->Proxy_Generation](FVector Value, float Time, bool bStopped)
 			{
-				if (IsProxyValid(Proxy))
+				if (IsProxyValid(Proxy, ProxyGeneration))
 				{
 					Proxy->OnFinished.Broadcast(Value, Time, bStopped);
 					Proxy->ClearAsyncBPAction();
 				}
-			},
-		Settings);
+			});
 		Handle = FECFHandleBP(Proxy->Proxy_Handle);
 	}
 
@@ -2,23 +2,24 @@
 
 #include "ECFDelayBP.h"
 #include "EnhancedCodeFlow.h"
+#include "CodeFlowActions/ECFDelay.h"
 
 ECF_PRAGMA_DISABLE_OPTIMIZATION
 
 UECFDelayBP* UECFDelayBP::ECFDelay(const UObject* WorldContextObject, float DelayTime, FECFActionSettings Settings, FECFHandleBP& Handle)
 {
-	UECFDelayBP* Proxy = NewObject<UECFDelayBP>();
+	UECFDelayBP* Proxy = CreateProxy<UECFDelayBP>(WorldContextObject);
 	if (Proxy)
 	{
 		Proxy->Init(WorldContextObject, Settings);
-		Proxy->Proxy_Handle = FFlow::Delay(WorldContextObject, DelayTime, [Proxy](bool bStopped)
+		Proxy->StartProxyAction<UECFDelay>(Settings, FECFInstanceId(), DelayTime, [Proxy, ProxyGeneration = Proxy->Proxy_Generation](bool bStopped)
 		{
-			if (IsProxyValid(Proxy))
+			if (IsProxyValid(Proxy, ProxyGeneration))
 			{
 				Proxy->OnComplete.Broadcast(bStopped);
 				Proxy->ClearAsyncBPAction();
 			}
-		}, Settings);
+		});
 		Handle = FECFHandleBP(Proxy->Proxy_Handle);
 	}
 
@@ -2,23 +2,24 @@
 
 #include "ECFDelayTicksBP.h"
 #include "EnhancedCodeFlow.h"
+#include "CodeFlowActions/ECFDelayTicks.h"
 
 ECF_PRAGMA_DISABLE_OPTIMIZATION
 
 UECFDelayTicksBP* UECFDelayTicksBP::ECFDelayTicks(const UObject* WorldContextObject, int32 DelayTicks, FECFActionSettings Settings, FECFHandleBP& Handle)
 {
-	UECFDelayTicksBP* Proxy = NewObject<UECFDelayTicksBP>();
+	UECFDelayTicksBP* Proxy = CreateProxy<UECFDelayTicksBP>(WorldContextObject);
 	if (Proxy)
 	{
 		Proxy->Init(WorldContextObject, Settings);
-		Proxy->Proxy_Handle = FFlow::DelayTicks(WorldContextObject, DelayTicks, [Proxy](bool bStopped)
+		Proxy->StartProxyAction<UECFDelayTicks>(Settings, FECFInstanceId(), DelayTicks, [Proxy, ProxyGeneration = Proxy->Proxy_Generation](bool bStopped)
 		{
-			if (IsProxyValid(Proxy))
+			if (IsProxyValid(Proxy, ProxyGeneration))
 			{
 				Proxy->OnComplete.Broadcast(bStopped);
 				Proxy->ClearAsyncBPAction();
 			}
-		}, Settings);
+		});
 		Handle = FECFHandleBP(Proxy->Proxy_Handle);
 	}
 
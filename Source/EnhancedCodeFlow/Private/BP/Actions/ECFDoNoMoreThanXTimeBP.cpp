@@ -2,13 +2,14 @@
 
 #include "ECFDoNoMoreThanXTimeBP.h"
 #include "EnhancedCodeFlow.h"
+#include "CodeFlowActions/ECFDoNoMoreThanXTime.h"
 #include "BP/ECFBPLibrary.h"
 
 ECF_PRAGMA_DISABLE_OPTIMIZATION
 
 UECFDoNoMoreThanXTimeBP* UECFDoNoMoreThanXTimeBP::ECFDoNoMoreThanXTime(const UObject* WorldContextObject, float Time, FECFHandleBP& Handle, FECFInstanceIdBP& InstanceId, FECFActionSettings Settings, int32 MaxExecsEnqueued /*= 1*/)
 {
-	UECFDoNoMoreThanXTimeBP* Proxy = NewObject<UECFDoNoMoreThanXTimeBP>();
+	UECFDoNoMoreThanXTimeBP* Proxy = CreateProxy<UECFDoNoMoreThanXTimeBP>(WorldContextObject);
 	if (Proxy)
 	{
 		Proxy->Init(WorldContextObject, Settings);
@@ -18,12 +19,12 @@ UECFDoNoMoreThanXTimeBP* UECFDoNoMoreThanXTimeBP::ECFDoNoMoreThanXTime(const UOb
 			UECFBPLibrary::ECFGetNewInstanceId(InstanceId);
 		}
 
-		Proxy->Proxy_Handle = FFlow::DoNoMoreThanXTime(WorldContextObject, [Proxy]()
+		Proxy->StartProxyAction<UECFDoNoMoreThanXTime>(Settings, InstanceId.InstanceId, [Proxy, ProxyGeneration = Proxy->Proxy_Generation]()
 		{
 			// Because the action will be executed on first call, check if the async action has been activated.
 			// Not activated actions don't have bindings to delegates! 
 			// Enqueue the OnExecute broadcast for the activation.
-			if (IsProxyValid(Proxy))
+			if (IsProxyValid(Proxy, ProxyGeneration))
 			{
 				if (Proxy->bActivated)
 				{
@@ -35,7 +36,7 @@ UECFDoNoMoreThanXTimeBP* UECFDoNoMoreThanXTimeBP::ECFDoNoMoreThanXTime(const UOb
 					Proxy->bExecuteOnActivation = true;
 				}
 			}
-		}, Time, MaxExecsEnqueued, InstanceId.InstanceId, Settings);
+		}, Time, MaxExecsEnqueued);
 		Handle = FECFHandleBP(Proxy->Proxy_Handle);
 	}
 
@@ -55,4 +56,10 @@ void UECFDoNoMoreThanXTimeBP::Activate()
 	}
 }
 
+void UECFDoNoMoreThanXTimeBP::ResetProxy()
+{
+	Super::ResetProxy();
+	bExecuteOnActivation = false;
+}
+
 ECF_PRAGMA_ENABLE_OPTIMIZATION
\ No newline at end of file
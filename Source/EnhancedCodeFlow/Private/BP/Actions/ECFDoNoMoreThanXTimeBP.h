@@ -24,4 +24,8 @@ public:
 	
 
 	void Activate() override;
+
+protected:
+
+	void ResetProxy() override;
 };
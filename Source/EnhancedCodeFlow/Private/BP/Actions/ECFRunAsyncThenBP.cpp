@@ -2,32 +2,33 @@
 
 #include "ECFRunAsyncThenBP.h"
 #include "EnhancedCodeFlow.h"
+#include "CodeFlowActions/ECFRunAsyncThen.h"
 
 ECF_PRAGMA_DISABLE_OPTIMIZATION
 
 UECFRunAsyncThenBP* UECFRunAsyncThenBP::ECFRunAsyncThen(const UObject* WorldContextObject, float InTimeOut, EECFAsyncPrio Priority, FECFActionSettings Settings, FECFHandleBP& Handle)
 {
-	UECFRunAsyncThenBP* Proxy = NewObject<UECFRunAsyncThenBP>();
+	UECFRunAsyncThenBP* Proxy = CreateProxy<UECFRunAsyncThenBP>(WorldContextObject);
 	if (Proxy)
 	{
 		Proxy->Init(WorldContextObject, Settings);
-		Proxy->Proxy_Handle = FFlow::RunAsyncThen(WorldContextObject,
-			[Proxy]()
+		Proxy->StartProxyAction<UECFRunAsyncThen>(Settings, FECFInstanceId(),
+			[Proxy, ProxyGeneration = Proxy->Proxy_Generation](const FECFCancellationToken& Token)
 			{
-				if (IsProxyValid(Proxy))
+				if (IsProxyValid(Proxy, ProxyGeneration))
 				{
 					Proxy->AsyncTask.Broadcast(false, false);
 				}
 			},
-			[Proxy](bool bTimedOut, bool bStopped)
+			[Proxy, ProxyGeneration = Proxy->Proxy_Generation](bool bTimedOut, bool bStopped)
 			{
-				if (IsProxyValid(Proxy))
+				if (IsProxyValid(Proxy, ProxyGeneration))
 				{
 					Proxy->OnExecute.Broadcast(bTimedOut, bStopped);
 					Proxy->ClearAsyncBPAction();
 				}
 			},
-		InTimeOut, Priority, Settings);
+		InTimeOut, Priority);
 		Handle = FECFHandleBP(Proxy->Proxy_Handle);
 	}
 
@@ -23,4 +23,9 @@ public:
 
 	UFUNCTION(BlueprintCallable, meta = (BlueprintInternalUseOnly = "true", WorldContext = "WorldContextObject", AdvancedDisplay = "Settings", ToolTip = "Runs the given task function on a separate thread and calls the callback function when this task ends.\nSet TimeOut greater than 0 to stop action after this time.", DisplayName = "ECF - Run Async Then"), Category = "ECF")
 	static UECFRunAsyncThenBP* ECFRunAsyncThen(const UObject* WorldContextObject, float InTimeOut, EECFAsyncPrio Priority, FECFActionSettings Settings, FECFHandleBP& Handle);
+
+protected:
+
+	// The async task can still broadcast from it's thread after the node has timed out, so this proxy can't be reused.
+	bool CanBePooled() const override { return false; }
 };
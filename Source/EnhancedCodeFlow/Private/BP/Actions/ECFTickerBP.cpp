@@ -2,32 +2,34 @@
 
 #include "ECFTickerBP.h"
 #include "EnhancedCodeFlow.h"
+#include "CodeFlowActions/ECFTicker.h"
 
 ECF_PRAGMA_DISABLE_OPTIMIZATION
 
-UECFTickerBP* UECFTickerBP::ECFTicker(const UObject* WorldContextObject, float TickingTime, FECFActionSettings Settings, FECFHandleBP& Handle)
+UECFTickerBP* UECFTickerBP::ECFTicker(const UObject* WorldContextObject, float TickingTime, FECFActionSettings Settings, FECFHandleBP& Handle, float TickEventInterval /*= 0.f*/)
 {
-	UECFTickerBP* Proxy = NewObject<UECFTickerBP>();
+	UECFTickerBP* Proxy = CreateProxy<UECFTickerBP>(WorldContextObject);
 	if (Proxy)
 	{
 		Proxy->Init(WorldContextObject, Settings);
-		Proxy->Proxy_Handle = FFlow::AddTicker(WorldContextObject, TickingTime,
-			[Proxy](float DeltaTime)
+		Proxy->Proxy_TickEventInterval = TickEventInterval;
+		Proxy->StartProxyAction<UECFTicker>(Settings, FECFInstanceId(), TickingTime,
+			[Proxy, ProxyGeneration = Proxy->Proxy_Generation](float DeltaTime)
 			{
-				if (IsProxyValid(Proxy))
+				float BroadcastDeltaTime = DeltaTime;
+				if (IsProxyValid(Proxy, ProxyGeneration) && Proxy->ShouldBroadcastTick(BroadcastDeltaTime))
 				{
-					Proxy->OnTick.Broadcast(DeltaTime, false);
+					Proxy->OnTick.Broadcast(BroadcastDeltaTime, false);
 				}
 			}, 
-			[Proxy](bool bStopped)
+			[Proxy, ProxyGeneration = Proxy->Proxy_Generation](bool bStopped)
 			{
-				if (IsProxyValid(Proxy))
+				if (IsProxyValid(Proxy, ProxyGeneration))
 				{
 					Proxy->OnComplete.Broadcast(0.f, bStopped);
 					Proxy->ClearAsyncBPAction();
 				}
-			}, 
-		Settings);
+			});
 		Handle = FECFHandleBP(Proxy->Proxy_Handle);
 	}
 
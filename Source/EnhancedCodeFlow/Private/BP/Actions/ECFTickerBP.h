@@ -20,6 +20,10 @@ public:
 	UPROPERTY(BlueprintAssignable)
 	FOnECFTickerBPEvent OnComplete;
 
-	UFUNCTION(BlueprintCallable, meta = (BlueprintInternalUseOnly = "true", WorldContext = "WorldContextObject", AdvancedDisplay = "Settings", ToolTip = "Creates a ticker. It can tick specified amount of time or until it won't be stopped or when owning object won't be destroyed.\nTo run ticker infinitely set TickingTime to -1.", DisplayName = "ECF - Ticker"), Category = "ECF")
-	static UECFTickerBP* ECFTicker(const UObject* WorldContextObject, float TickingTime, FECFActionSettings Settings, FECFHandleBP& Handle);
+	UFUNCTION(BlueprintCallable, meta = (BlueprintInternalUseOnly = "true", WorldContext = "WorldContextObject", AdvancedDisplay = "Settings, TickEventInterval", ToolTip = "Creates a ticker. It can tick specified amount of time or until it won't be stopped or when owning object won't be destroyed.\nTo run ticker infinitely set TickingTime to -1.\nTickEventInterval limits how often OnTick is called. If 0, it is called on every tick.", DisplayName = "ECF - Ticker"), Category = "ECF")
+	static UECFTickerBP* ECFTicker(const UObject* WorldContextObject, float TickingTime, FECFActionSettings Settings, FECFHandleBP& Handle, float TickEventInterval = 0.f);
+
+protected:
+
+	bool IsTickEventBound() const override { return OnTick.IsBound(); }
 };
@@ -2,33 +2,35 @@
 
 #include "ECFTimelineBP.h"
 #include "EnhancedCodeFlow.h"
+#include "CodeFlowActions/ECFTimeline.h"
 
 ECF_PRAGMA_DISABLE_OPTIMIZATION
 
-UECFTimelineBP* UECFTimelineBP::ECFTimeline(const UObject* WorldContextObject, float StartValue, float StopValue, float Time, FECFActionSettings Settings, FECFHandleBP& Handle, EECFBlendFunc BlendFunc /*= EECFBlendFunc::ECFBlend_Linear*/, float BlendExp /*= 1.f*/)
+UECFTimelineBP* UECFTimelineBP::ECFTimeline(const UObject* WorldContextObject, float StartValue, float StopValue, float Time, FECFActionSettings Settings, FECFHandleBP& Handle, EECFBlendFunc BlendFunc /*= EECFBlendFunc::ECFBlend_Linear*/, float BlendExp /*= 1.f*/, float TickEventInterval /*= 0.f*/)
 {
-	UECFTimelineBP* Proxy = NewObject<UECFTimelineBP>();
+	UECFTimelineBP* Proxy = CreateProxy<UECFTimelineBP>(WorldContextObject);
 	if (Proxy)
 	{
 		Proxy->Init(WorldContextObject, Settings);
-		Proxy->Proxy_Handle = FFlow::AddTimeline(WorldContextObject,
+		Proxy->Proxy_TickEventInterval = TickEventInterval;
+		Proxy->StartProxyAction<UECFTimeline>(Settings, FECFInstanceId(),
 			StartValue, StopValue, Time,
-			[Proxy](float Value, float Time)
+			[Proxy, ProxyGeneration = Proxy->Proxy_Generation](float Value, float Time)
 			{
-				if (IsProxyValid(Proxy))
+				if (IsProxyValid(Proxy, ProxyGeneration) && Proxy->ShouldBroadcastTimelineTick(Time))
 				{
 					Proxy->OnTick.Broadcast(Value, Time, false);
 				}
 			},
-			[Proxy](float Value, float Time, bool bStopped)
+			[Proxy, ProxyGeneration = Proxy->Proxy_Generation](float Value, float Time, bool bStopped)
 			{
-				if (IsProxyValid(Proxy))
+				if (IsProxyValid(Proxy, ProxyGeneration))
 				{
 					Proxy->OnFinished.Broadcast(Value, Time, false);
 					Proxy->ClearAsyncBPAction();
 				}
 			},
-			BlendFunc, BlendExp, Settings);
+			BlendFunc, BlendExp);
 		Handle = FECFHandleBP(Proxy->Proxy_Handle);
 	}
 
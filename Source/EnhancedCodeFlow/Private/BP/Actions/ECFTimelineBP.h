@@ -21,6 +21,10 @@ public:
 	UPROPERTY(BlueprintAssignable)
 	FOnECFTimelineBPEvent OnFinished;
 	
-	UFUNCTION(BlueprintCallable, meta = (BlueprintInternalUseOnly = "true", WorldContext = "WorldContextObject", AdvancedDisplay = "Settings, BlendFunc, BlendExp", ToolTip = "Adds a simple timeline that runs in a given range during a given time.", DisplayName = "ECF - Timeline"), Category = "ECF")
-	static UECFTimelineBP* ECFTimeline(const UObject* WorldContextObject, float StartValue, float StopValue, float Time, FECFActionSettings Settings, FECFHandleBP& Handle, EECFBlendFunc BlendFunc = EECFBlendFunc::ECFBlend_Linear, float BlendExp = 1.f);
+	UFUNCTION(BlueprintCallable, meta = (BlueprintInternalUseOnly = "true", WorldContext = "WorldContextObject", AdvancedDisplay = "Settings, BlendFunc, BlendExp, TickEventInterval", ToolTip = "Adds a simple timeline that runs in a given range during a given time.\nTickEventInterval limits how often OnTick is called. If 0, it is called on every tick.", DisplayName = "ECF - Timeline"), Category = "ECF")
+	static UECFTimelineBP* ECFTimeline(const UObject* WorldContextObject, float StartValue, float StopValue, float Time, FECFActionSettings Settings, FECFHandleBP& Handle, EECFBlendFunc BlendFunc = EECFBlendFunc::ECFBlend_Linear, float BlendExp = 1.f, float TickEventInterval = 0.f);
+
+protected:
+
+	bool IsTickEventBound() const override { return OnTick.IsBound(); }
 };
@@ -2,33 +2,35 @@
 
 #include "ECFTimelineLinearColorBP.h"
 #include "EnhancedCodeFlow.h"
+#include "CodeFlowActions/ECFTimelineLinearColor.h"
 
 ECF_PRAGMA_DISABLE_OPTIMIZATION
 
-UECFTimelineLinearColorBP* UECFTimelineLinearColorBP::ECFTimelineLinearColor(const UObject* WorldContextObject, FLinearColor StartValue, FLinearColor StopValue, float Time, FECFActionSettings Settings, FECFHandleBP& Handle, EECFBlendFunc BlendFunc /*= EECFBlendFunc::ECFBlend_Linear*/, float BlendExp /*= 1.f*/)
+UECFTimelineLinearColorBP* UECFTimelineLinearColorBP::ECFTimelineLinearColor(const UObject* WorldContextObject, FLinearColor StartValue, FLinearColor StopValue, float Time, FECFActionSettings Settings, FECFHandleBP& Handle, EECFBlendFunc BlendFunc /*= EECFBlendFunc::ECFBlend_Linear*/, float BlendExp /*= 1.f*/, float TickEventInterval /*= 0.f*/)
 {
-	UECFTimelineLinearColorBP* Proxy = NewObject<UECFTimelineLinearColorBP>();
+	UECFTimelineLinearColorBP* Proxy = CreateProxy<UECFTimelineLinearColorBP>(WorldContextObject);
 	if (Proxy)
 	{
 		Proxy->Init(WorldContextObject, Settings);
-		Proxy->Proxy_Handle = FFlow::AddTimelineLinearColor(WorldContextObject,
+		Proxy->Proxy_TickEventInterval = TickEventInterval;
+		Proxy->StartProxyAction<UECFTimelineLinearColor>(Settings, FECFInstanceId(),
 			StartValue, StopValue, Time,
-			[Proxy](FLinearColor Value, float Time)
+			[Proxy, ProxyGeneration = Proxy->Proxy_Generation](FLinearColor Value, float Time)
 			{
-				if (IsProxyValid(Proxy))
+				if (IsProxyValid(Proxy, ProxyGeneration) && Proxy->ShouldBroadcastTimelineTick(Time))
 				{
 					Proxy->OnTick.Broadcast(Value, Time, false);
 				}
 			},
-			[Proxy](FLinearColor Value, float Time, bool bStopped)
+			[Proxy, ProxyGeneration = Proxy->Proxy_Generation](FLinearColor Value, float Time, bool bStopped)
 			{
-				if (IsProxyValid(Proxy))
+				if (IsProxyValid(Proxy, ProxyGeneration))
 				{
 					Proxy->OnFinished.Broadcast(Value, Time, false);
 					Proxy->ClearAsyncBPAction();
 				}
 			},
-			BlendFunc, BlendExp, Settings);
+			BlendFunc, BlendExp);
 		Handle = FECFHandleBP(Proxy->Proxy_Handle);
 	}
 
@@ -2,33 +2,35 @@
 
 #include "ECFTimelineVectorBP.h"
 #include "EnhancedCodeFlow.h"
+#include "CodeFlowActions/ECFTimelineVector.h"
 
 ECF_PRAGMA_DISABLE_OPTIMIZATION
 
-UECFTimelineVectorBP* UECFTimelineVectorBP::ECFTimelineVector(const UObject* WorldContextObject, FVector StartValue, FVector StopValue, float Time, FECFActionSettings Settings, FECFHandleBP& Handle, EECFBlendFunc BlendFunc /*= EECFBlendFunc::ECFBlend_Linear*/, float BlendExp /*= 1.f*/)
+UECFTimelineVectorBP* UECFTimelineVectorBP::ECFTimelineVector(const UObject* WorldContextObject, FVector StartValue, FVector StopValue, float Time, FECFActionSettings Settings, FECFHandleBP& Handle, EECFBlendFunc BlendFunc /*= EECFBlendFunc::ECFBlend_Linear*/, float BlendExp /*= 1.f*/, float TickEventInterval /*= 0.f*/)
 {
-	UECFTimelineVectorBP* Proxy = NewObject<UECFTimelineVectorBP>();
+	UECFTimelineVectorBP* Proxy = CreateProxy<UECFTimelineVectorBP>(WorldContextObject);
 	if (Proxy)
 	{
 		Proxy->Init(WorldContextObject, Settings);
-		Proxy->Proxy_Handle = FFlow::AddTimelineVector(WorldContextObject,
+		Proxy->Proxy_TickEventInterval = TickEventInterval;
+		Proxy->StartProxyAction<UECFTimelineVector>(Settings, FECFInstanceId(),
 			StartValue, StopValue, Time,
-			[Proxy](FVector Value, float Time)
+			[Proxy, ProxyGeneration = Proxy->Proxy_Generation](FVector Value, float Time)
 			{
-				if (IsProxyValid(Proxy))
+				if (IsProxyValid(Proxy, ProxyGeneration) && Proxy->ShouldBroadcastTimelineTick(Time))
 				{
 					Proxy->OnTick.Broadcast(Value, Time, false);
 				}
 			},
-			[Proxy](FVector Value, float Time, bool bStopped)
+			[Proxy, ProxyGeneration = Proxy->Proxy_Generation](FVector Value, float Time, bool bStopped)
 			{
-				if (IsProxyValid(Proxy))
+				if (IsProxyValid(Proxy, ProxyGeneration))
 				{
 					Proxy->OnFinished.Broadcast(Value, Time, false);
 					Proxy->ClearAsyncBPAction();
 				}
 			},
-			BlendFunc, BlendExp, Settings);
+			BlendFunc, BlendExp);
 		Handle = FECFHandleBP(Proxy->Proxy_Handle);
 	}
 
@@ -2,35 +2,36 @@
 
 #include "ECFWaitAndExecuteBP.h"
 #include "EnhancedCodeFlow.h"
+#include "CodeFlowActions/ECFWaitAndExecute_WithDeltaTime.h"
 
 ECF_PRAGMA_DISABLE_OPTIMIZATION
 
 UECFWaitAndExecuteBP* UECFWaitAndExecuteBP::ECFWaitAndExecute(const UObject* WorldContextObject, float InTimeOut, FECFActionSettings Settings, FECFHandleBP& Handle)
 {
-	UECFWaitAndExecuteBP* Proxy = NewObject<UECFWaitAndExecuteBP>();
+	UECFWaitAndExecuteBP* Proxy = CreateProxy<UECFWaitAndExecuteBP>(WorldContextObject);
 	if (Proxy)
 	{
 		Proxy->Init(WorldContextObject, Settings);
 		Proxy->Proxy_HasFinished = false;
-		Proxy->Proxy_Handle = FFlow::WaitAndExecute(WorldContextObject,
-			[Proxy](float DeltaTime)
+		Proxy->StartProxyAction<UECFWaitAndExecute_WithDeltaTime>(Settings, FECFInstanceId(),
+			[Proxy, ProxyGeneration = Proxy->Proxy_Generation](float DeltaTime)
 			{
-				if (IsProxyValid(Proxy))
+				if (IsProxyValid(Proxy, ProxyGeneration))
 				{
 					Proxy->OnWait.Broadcast(Proxy, DeltaTime, false, false);
 					return Proxy->Proxy_HasFinished;
 				}
 				return true;
 			},
-			[Proxy](bool bTimedOut, bool bStopped)
+			[Proxy, ProxyGeneration = Proxy->Proxy_Generation](bool bTimedOut, bool bStopped)
 			{
-				if (IsProxyValid(Proxy))
+				if (IsProxyValid(Proxy, ProxyGeneration))
 				{
 					Proxy->OnExecute.Broadcast(Proxy, 0.f, bTimedOut, bStopped);
 					Proxy->ClearAsyncBPAction();
 				}
 			},
-		InTimeOut, Settings);
+		InTimeOut);
 		Handle = FECFHandleBP(Proxy->Proxy_Handle);
 	}
 
@@ -29,4 +29,7 @@ public:
 protected:
 
 	bool Proxy_HasFinished = false;
+
+	// Blueprints get this proxy and can call Predicate on it later, so it can't be reused.
+	bool CanBePooled() const override { return false; }
 };
@@ -2,42 +2,43 @@
 
 #include "ECFWhileTrueExecuteBP.h"
 #include "EnhancedCodeFlow.h"
+#include "CodeFlowActions/ECFWhileTrueExecute.h"
 
 ECF_PRAGMA_DISABLE_OPTIMIZATION
 
 UECFWhileTrueExecuteBP* UECFWhileTrueExecuteBP::ECFWhileTrueExecute(const UObject* WorldContextObject, float TimeOut, FECFActionSettings Settings, FECFHandleBP& Handle)
 {
-	UECFWhileTrueExecuteBP* Proxy = NewObject<UECFWhileTrueExecuteBP>();
+	UECFWhileTrueExecuteBP* Proxy = CreateProxy<UECFWhileTrueExecuteBP>(WorldContextObject);
 	if (Proxy)
 	{
 		Proxy->Init(WorldContextObject, Settings);
 		Proxy->Proxy_IsTrue = true;
-		Proxy->Proxy_Handle = FFlow::WhileTrueExecute(WorldContextObject,
-			[Proxy]()
+		Proxy->StartProxyAction<UECFWhileTrueExecute>(Settings, FECFInstanceId(),
+			[Proxy, ProxyGeneration = Proxy->Proxy_Generation]()
 			{
-				if (IsProxyValid(Proxy))
+				if (IsProxyValid(Proxy, ProxyGeneration))
 				{
 					Proxy->OnWhile.Broadcast(Proxy, 0.f, false, false);
 					return Proxy->Proxy_IsTrue;
 				}
 				return false;
 			},
-			[Proxy](float DeltaTime)
+			[Proxy, ProxyGeneration = Proxy->Proxy_Generation](float DeltaTime)
 			{
-				if (IsProxyValid(Proxy))
+				if (IsProxyValid(Proxy, ProxyGeneration))
 				{
 					Proxy->OnExecute.Broadcast(Proxy, DeltaTime, false, false);
 				}
 			},
-			[Proxy](bool bTimedOut, bool bStopped)
+			[Proxy, ProxyGeneration = Proxy->Proxy_Generation](bool bTimedOut, bool bStopped)
 			{
-				if (IsProxyValid(Proxy))
+				if (IsProxyValid(Proxy, ProxyGeneration))
 				{
 					Proxy->OnComplete.Broadcast(Proxy, 0.f, bTimedOut, bStopped);
 					Proxy->ClearAsyncBPAction();
 				}
 			},
-		TimeOut, Settings);
+		TimeOut);
 		Handle = FECFHandleBP(Proxy->Proxy_Handle);
 	}
 
@@ -32,4 +32,7 @@ public:
 protected:
 
 	bool Proxy_IsTrue = true;
+
+	// Blueprints get this proxy and can call Predicate on it later, so it can't be reused.
+	bool CanBePooled() const override { return false; }
 };
@@ -2,13 +2,26 @@
 
 #include "ECFActionBP.h"
 #include "EnhancedCodeFlow.h"
+#include "ECFSubsystem.h"
+#include "ECFActionBase.h"
 #include "ECFStats.h"
+#include "HAL/IConsoleManager.h"
+#include "UObject/UnrealType.h"
 #include "Runtime/Launch/Resources/Version.h"
 
 ECF_PRAGMA_DISABLE_OPTIMIZATION
 
 DEFINE_STAT(STAT_ECF_AsyncBPObjectsCount);
 
+static bool GECFBPProxyPool = true;
+static FAutoConsoleVariableRef CVarECFBPProxyPool(
+	TEXT("ECF.BPProxyPool"),
+	GECFBPProxyPool,
+	TEXT("If enabled, proxy objects of finished Blueprint async nodes are reused by next nodes instead of being garbage collected."));
+
+// Maximum amount of proxies waiting in the pool of one subsystem.
+static constexpr int32 MaxPooledBPProxies = 64;
+
 UECFActionBP::UECFActionBP()
 {
 #if STATS
@@ -38,15 +51,142 @@ UWorld* UECFActionBP::GetWorld() const
 void UECFActionBP::Activate()
 {
 	bActivated = true;
-	if (Proxy_IsPausedAtStart == false)
+	if (UECFActionBase* Action = GetProxyAction())
+	{
+		if (Proxy_IsPausedAtStart == false)
+		{
+			Action->bIsPaused = false;
+		}
+
+		// Events are bound by the Blueprint node before it's activated.
+		if (IsTickEventBound() == false)
+		{
+			Action->RemoveTickFunc();
+		}
+	}
+}
+
+UECFActionBase* UECFActionBP::GetProxyAction() const
+{
+	if (Proxy_Action.IsExplicitlyNull())
+	{
+		// The action hasn't been kept when the node was created (e.g. an already running instanced action has been returned).
+		if (UECFSubsystem* ECF = UECFSubsystem::Get(Proxy_WorldContextObject))
+		{
+			return ECF->FindAction(Proxy_Handle);
+		}
+		return nullptr;
+	}
+	return Proxy_Action.Get();
+}
+
+void UECFActionBP::SetProxyAction(const FECFHandle& InHandle)
+{
+	Proxy_Handle = InHandle;
+	Proxy_Action = nullptr;
+	if (UECFSubsystem* ECF = GetProxySubsystem(Proxy_WorldContextObject))
+	{
+		Proxy_Action = ECF->FindAction(InHandle);
+	}
+}
+
+bool UECFActionBP::IsPoolEnabled()
+{
+	return GECFBPProxyPool;
+}
+
+UECFActionBP* UECFActionBP::CreateProxy(const UObject* WorldContextObject, UClass* ProxyClass)
+{
+	if (IsPoolEnabled())
 	{
-		FFlow::ResumeAction(Proxy_WorldContextObject, Proxy_Handle);
+		if (UECFSubsystem* ECF = GetProxySubsystem(WorldContextObject))
+		{
+			for (int32 ProxyId = ECF->PooledBPProxies.Num() - 1; ProxyId >= 0; ProxyId--)
+			{
+				UECFActionBP* PooledProxy = ECF->PooledBPProxies[ProxyId];
+				if (PooledProxy && (PooledProxy->GetClass() == ProxyClass))
+				{
+					ECF->PooledBPProxies.RemoveAtSwap(ProxyId);
+
+					// SetReadyToDestroy has cleared the strong reference from the Blueprint frame. Restore it,
+					// as it is done for new proxies, so the reused proxy isn't garbage collected while it's action runs.
+					PooledProxy->SetFlags(RF_StrongRefOnFrame);
+					return PooledProxy;
+				}
+			}
+		}
 	}
+
+	return NewObject<UECFActionBP>(GetTransientPackage(), ProxyClass);
+}
+
+void UECFActionBP::ResetProxy()
+{
+	Proxy_Generation++;
+	Proxy_WorldContextObject = nullptr;
+	Proxy_Handle.Invalidate();
+	Proxy_Action = nullptr;
+	Proxy_TickEventInterval = 0.f;
+	Proxy_TickEventTime = 0.f;
+	Proxy_IsPausedAtStart = false;
+	bActivated = false;
+
+	// Forget events bound by the Blueprint node which has used this proxy.
+	for (TFieldIterator<FMulticastDelegateProperty> It(GetClass()); It; ++It)
+	{
+		It->ClearDelegate(this, It->ContainerPtrToValuePtr<void>(this));
+	}
+}
+
+bool UECFActionBP::ShouldBroadcastTick(float& InOutDeltaTime)
+{
+	if (Proxy_TickEventInterval <= 0.f)
+	{
+		return true;
+	}
+
+	Proxy_TickEventTime += InOutDeltaTime;
+	if (Proxy_TickEventTime < Proxy_TickEventInterval)
+	{
+		return false;
+	}
+
+	InOutDeltaTime = Proxy_TickEventTime;
+	Proxy_TickEventTime = 0.f;
+	return true;
+}
+
+bool UECFActionBP::ShouldBroadcastTimelineTick(float TimelineTime)
+{
+	if (Proxy_TickEventInterval <= 0.f)
+	{
+		return true;
+	}
+
+	if (TimelineTime < Proxy_TickEventTime)
+	{
+		return false;
+	}
+
+	Proxy_TickEventTime = TimelineTime + Proxy_TickEventInterval;
+	return true;
 }
 
 void UECFActionBP::ClearAsyncBPAction()
 {
 	SetReadyToDestroy();
+
+	if (IsPoolEnabled() && CanBePooled())
+	{
+		UECFSubsystem* ECF = GetProxySubsystem(Proxy_WorldContextObject);
+		if (ECF && (ECF->PooledBPProxies.Num() < MaxPooledBPProxies))
+		{
+			ResetProxy();
+			ECF->PooledBPProxies.Add(this);
+			return;
+		}
+	}
+
 #if (ENGINE_MAJOR_VERSION == 5)
 	MarkAsGarbage();
 #else
@@ -61,4 +201,18 @@ bool UECFActionBP::IsProxyValid(const UObject* ProxyObject)
 	return bIsValid;
 }
 
+bool UECFActionBP::IsProxyValid(const UECFActionBP* ProxyObject, uint32 ProxyGeneration)
+{
+	return IsProxyValid(static_cast<const UObject*>(ProxyObject)) && (ProxyObject->Proxy_Generation == ProxyGeneration);
+}
+
+UECFSubsystem* UECFActionBP::GetProxySubsystem(const UObject* WorldContextObject)
+{
+	if (IsValid(WorldContextObject) && WorldContextObject->GetWorld())
+	{
+		return UECFSubsystem::Get(WorldContextObject);
+	}
+	return nullptr;
+}
+
 ECF_PRAGMA_ENABLE_OPTIMIZATION
\ No newline at end of file
@@ -4,6 +4,7 @@
 
 #include "Kismet/BlueprintAsyncActionBase.h"
 #include "ECFActionSettings.h"
+#include "ECFSubsystem.h"
 #include "BP/ECFHandleBP.h"
 #include "ECFActionBP.generated.h"
 
@@ -33,11 +34,36 @@ public:
 
 	/**
 	 * Activate the action by resuming it (we always start it as paused).
+	 * The action kept by the proxy is resumed directly, without searching for it by the handle.
+	 * If nothing is bound to the tick event of this node, the action is told to not launch it's tick function.
 	 */
 	void Activate() override;
 
+	/**
+	 * Checks if pooling of proxies is enabled (controlled by the ECF.BPProxyPool console variable).
+	 */
+	static bool IsPoolEnabled();
+
 protected:
 
+	// Returns a proxy of the given class. Proxies of finished nodes are reused if possible.
+	template<typename T>
+	static T* CreateProxy(const UObject* WorldContextObject)
+	{
+		return CastChecked<T>(CreateProxy(WorldContextObject, T::StaticClass()), ECastCheckedType::NullAllowed);
+	}
+	static UECFActionBP* CreateProxy(const UObject* WorldContextObject, UClass* ProxyClass);
+
+	// Checks if this proxy can be reused by other nodes after it's finished.
+	// Proxies which pass themselves to Blueprints or can broadcast events after they're finished can't.
+	virtual bool CanBePooled() const { return true; }
+
+	// Restores the initial state of the proxy before it's reused.
+	virtual void ResetProxy();
+
+	// Incremented every time the proxy is reused, so callbacks of the previous node can be ignored.
+	uint32 Proxy_Generation = 0;
+
 	// The World Context Object that started this action.
 	UPROPERTY(Transient)
 	TObjectPtr<const UObject> Proxy_WorldContextObject;
@@ -45,15 +71,61 @@ protected:
 	// Handle of the Action to control.
 	FECFHandle Proxy_Handle;
 
+	// The Action to control, kept when the node is created, so it doesn't have to be found by the handle later.
+	TWeakObjectPtr<class UECFActionBase> Proxy_Action;
+
+	// Minimal time between broadcasts of the tick event. If 0 the event is broadcasted on every tick of the action.
+	float Proxy_TickEventInterval = 0.f;
+
+	// For tickers - time accumulated since the last broadcast of the tick event.
+	// For timelines - time of the timeline at which the next tick event can be broadcasted.
+	float Proxy_TickEventTime = 0.f;
+
 	// If the action was supposed to be paused - to not resume it on Activate!
 	bool Proxy_IsPausedAtStart;
 
 	// Just a handy flag to check if the action has been activated already.
 	bool bActivated = false;
 
+	// Sets the handle of the Action started by this node and keeps the Action itself.
+	void SetProxyAction(const FECFHandle& InHandle);
+
+	// Starts the Action of this node with the given arguments and keeps it.
+	// The callbacks of the node are passed to the Action as they are, so the completion callback is stored inside of the Action,
+	// instead of getting wrapped in a separately allocated TUniqueFunction first.
+	template<typename T, typename ... Ts>
+	void StartProxyAction(const FECFActionSettings& Settings, const FECFInstanceId& InstanceId, Ts&& ... Args)
+	{
+		if (UECFSubsystem* ECF = UECFSubsystem::Get(Proxy_WorldContextObject))
+			SetProxyAction(ECF->AddAction<T>(Proxy_WorldContextObject, Settings, InstanceId, Forward<Ts>(Args)...));
+		else
+			SetProxyAction(FECFHandle());
+	}
+
+	// Checks if anything is bound to the tick event of this node. If not, the action will not launch it's tick function at all.
+	virtual bool IsTickEventBound() const { return true; }
+
+	// Checks if the tick event of the ticker should be broadcasted, respecting the tick event interval.
+	// If it should, InOutDeltaTime is set to the time passed since the last broadcast.
+	bool ShouldBroadcastTick(float& InOutDeltaTime);
+
+	// Checks if the tick event of the timeline at the given time should be broadcasted, respecting the tick event interval.
+	bool ShouldBroadcastTimelineTick(float TimelineTime);
+
 	// Mark this async node as ready to destroy.
 	void ClearAsyncBPAction();
 
 	// Checks if the given proxy object is still valid and safe to use.
 	static bool IsProxyValid(const UObject* ProxyObject);
+
+	// The same as the above, but it also checks if the proxy hasn't been reused by another node since the given generation.
+	static bool IsProxyValid(const UECFActionBP* ProxyObject, uint32 ProxyGeneration);
+
+private:
+
+	// Returns the Action started by this node, or nullptr if it's no longer running.
+	class UECFActionBase* GetProxyAction() const;
+
+	// Returns the subsystem of the given World Context Object, without ensuring the world is still valid.
+	static class UECFSubsystem* GetProxySubsystem(const UObject* WorldContextObject);
 };
@@ -0,0 +1,59 @@
+// Copyright (c) 2024 Damian Nowakowski. All rights reserved.
+
+#include "Coroutines/ECFCoroutine.h"
+
+ECF_PRAGMA_DISABLE_OPTIMIZATION
+
+FECFCoroutineLaunch*& FECFCoroutineLaunch::Current()
+{
+	static thread_local FECFCoroutineLaunch* CurrentLaunch = nullptr;
+	return CurrentLaunch;
+}
+
+FECFTimeSlice::FECFTimeSlice(float InBudgetMs)
+	: BudgetSeconds(FMath::Max(InBudgetMs, 0.f) / 1000.0)
+	, SliceStartTime(FPlatformTime::Seconds())
+	, bIsSliceStarted(true)
+{}
+
+bool FECFTimeSlice::ShouldYield()
+{
+	// The slice after the yield starts when the coroutine has been resumed.
+	if (bIsSliceStarted == false)
+	{
+		bIsSliceStarted = true;
+		SliceStartTime = FPlatformTime::Seconds();
+		SliceIterations = 0;
+		ChunkIterationsLeft = ChunkSize;
+	}
+
+	SliceIterations++;
+	if (--ChunkIterationsLeft > 0)
+	{
+		return false;
+	}
+
+	static constexpr int32 MaxChunkSize = 1 << 20;
+	const double ElapsedTime = FPlatformTime::Seconds() - SliceStartTime;
+	const double IterationTime = ElapsedTime / SliceIterations;
+	const bool bIsBudgetSpent = ElapsedTime >= BudgetSeconds;
+
+	// Check the time again when about a half of the remaining budget is spent.
+	// The chunk grows at most twice at once, so a few fast iterations won't make the next check come too late.
+	// The first chunk of the next slice is based on the first chunk of this one, as the last chunks are small.
+	const double TimeToNextCheck = (bIsBudgetSpent ? BudgetSeconds : BudgetSeconds - ElapsedTime) * 0.5;
+	const int32 EstimatedChunkSize = (IterationTime > 0.0) ? static_cast<int32>(FMath::Min(TimeToNextCheck / IterationTime, static_cast<double>(MaxChunkSize))) : MAX_int32;
+	ChunkSize = FMath::Clamp(EstimatedChunkSize, 1, FMath::Min((bIsBudgetSpent ? SliceChunkSize : ChunkSize) * 2, MaxChunkSize));
+	ChunkIterationsLeft = ChunkSize;
+
+	if (bIsBudgetSpent)
+	{
+		SliceChunkSize = ChunkSize;
+		bIsSliceStarted = false;
+		return true;
+	}
+
+	return false;
+}
+
+ECF_PRAGMA_ENABLE_OPTIMIZATION
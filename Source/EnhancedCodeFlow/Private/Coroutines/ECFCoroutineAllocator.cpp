@@ -0,0 +1,223 @@
+// Copyright (c) 2024 Damian Nowakowski. All rights reserved.
+
+#include "Coroutines/ECFCoroutineAllocator.h"
+#include "ECFStats.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/ScopeLock.h"
+
+ECF_PRAGMA_DISABLE_OPTIMIZATION
+
+DEFINE_STAT(STAT_ECF_CoroutineFramesMemory);
+DEFINE_STAT(STAT_ECF_CoroutineFramesPoolMemory);
+
+static bool GECFCoroutineFramePool = true;
+static FAutoConsoleVariableRef CVarECFCoroutineFramePool(
+	TEXT("ECF.CoroutineFramePool"),
+	GECFCoroutineFramePool,
+	TEXT("If enabled, frames of ECF coroutines are allocated from the pooled memory instead of the global allocator."));
+
+namespace ECFCoroutineAllocator
+{
+	// Every frame is preceded by a header, which tells how to free it.
+	// It has the size of the default new alignment, so the frame stays properly aligned.
+	struct alignas(16) FHeader
+	{
+		uint32 Size;
+		uint8 BucketId;
+	};
+	static_assert(sizeof(FHeader) == 16, "ECF coroutine frame header must keep the frame aligned.");
+
+	constexpr int32 BucketsNum = 7;
+	constexpr uint32 BucketSizes[BucketsNum] = { 64, 128, 256, 512, 1024, 2048, 4096 };
+	constexpr uint8 UnpooledBucketId = 0xFF;
+	constexpr SIZE_T ChunkSize = 64 * 1024;
+
+	// Free slots are linked through their own memory.
+	struct FFreeSlot
+	{
+		FFreeSlot* Next;
+	};
+
+	struct FPool
+	{
+		FCriticalSection Lock;
+		FFreeSlot* FreeSlots[BucketsNum] = {};
+		TArray<void*> Chunks;
+		int64 PooledBytesInUse = 0;
+		int64 BytesInUse = 0;
+		int64 BytesReserved = 0;
+	};
+
+	FPool& GetPool()
+	{
+		static FPool Pool;
+		return Pool;
+	}
+
+	int32 FindBucket(SIZE_T Size)
+	{
+		for (int32 BucketId = 0; BucketId < BucketsNum; BucketId++)
+		{
+			if (Size <= BucketSizes[BucketId])
+			{
+				return BucketId;
+			}
+		}
+		return INDEX_NONE;
+	}
+
+	// Splits a new chunk into slots of the given bucket. Must be called under the lock.
+	void AddChunk(FPool& Pool, int32 BucketId)
+	{
+		uint8* Chunk = static_cast<uint8*>(FMemory::Malloc(ChunkSize, alignof(FHeader)));
+		Pool.Chunks.Add(Chunk);
+		Pool.BytesReserved += ChunkSize;
+#if STATS
+		INC_MEMORY_STAT_BY(STAT_ECF_CoroutineFramesPoolMemory, ChunkSize);
+#endif
+
+		const uint32 SlotSize = BucketSizes[BucketId];
+		for (SIZE_T Offset = 0; Offset + SlotSize <= ChunkSize; Offset += SlotSize)
+		{
+			FFreeSlot* Slot = reinterpret_cast<FFreeSlot*>(Chunk + Offset);
+			Slot->Next = Pool.FreeSlots[BucketId];
+			Pool.FreeSlots[BucketId] = Slot;
+		}
+	}
+}
+
+bool FECFCoroutineAllocator::IsEnabled()
+{
+	return GECFCoroutineFramePool;
+}
+
+void* FECFCoroutineAllocator::Allocate(SIZE_T Size)
+{
+	using namespace ECFCoroutineAllocator;
+
+	const SIZE_T TotalSize = Size + sizeof(FHeader);
+	const int32 BucketId = IsEnabled() ? FindBucket(TotalSize) : INDEX_NONE;
+
+	FPool& Pool = GetPool();
+	FHeader* Header = nullptr;
+	uint32 AllocatedSize = 0;
+
+	if (BucketId != INDEX_NONE)
+	{
+		FScopeLock ScopeLock(&Pool.Lock);
+		if (Pool.FreeSlots[BucketId] == nullptr)
+		{
+			AddChunk(Pool, BucketId);
+		}
+
+		FFreeSlot* Slot = Pool.FreeSlots[BucketId];
+		Pool.FreeSlots[BucketId] = Slot->Next;
+
+		AllocatedSize = BucketSizes[BucketId];
+		Pool.PooledBytesInUse += AllocatedSize;
+		Pool.BytesInUse += AllocatedSize;
+
+		Header = reinterpret_cast<FHeader*>(Slot);
+		Header->BucketId = static_cast<uint8>(BucketId);
+	}
+	else
+	{
+		AllocatedSize = static_cast<uint32>(TotalSize);
+		Header = static_cast<FHeader*>(FMemory::Malloc(TotalSize, alignof(FHeader)));
+		Header->BucketId = UnpooledBucketId;
+
+		FScopeLock ScopeLock(&Pool.Lock);
+		Pool.BytesInUse += AllocatedSize;
+	}
+
+	Header->Size = AllocatedSize;
+
+#if STATS
+	INC_MEMORY_STAT_BY(STAT_ECF_CoroutineFramesMemory, AllocatedSize);
+#endif
+
+	return Header + 1;
+}
+
+void FECFCoroutineAllocator::Free(void* Ptr)
+{
+	using namespace ECFCoroutineAllocator;
+
+	if (Ptr == nullptr)
+	{
+		return;
+	}
+
+	FHeader* Header = static_cast<FHeader*>(Ptr) - 1;
+	const uint32 AllocatedSize = Header->Size;
+
+#if STATS
+	DEC_MEMORY_STAT_BY(STAT_ECF_CoroutineFramesMemory, AllocatedSize);
+#endif
+
+	FPool& Pool = GetPool();
+	if (Header->BucketId != UnpooledBucketId)
+	{
+		const int32 BucketId = Header->BucketId;
+
+		FScopeLock ScopeLock(&Pool.Lock);
+		FFreeSlot* Slot = reinterpret_cast<FFreeSlot*>(Header);
+		Slot->Next = Pool.FreeSlots[BucketId];
+		Pool.FreeSlots[BucketId] = Slot;
+
+		Pool.PooledBytesInUse -= AllocatedSize;
+		Pool.BytesInUse -= AllocatedSize;
+	}
+	else
+	{
+		FMemory::Free(Header);
+
+		FScopeLock ScopeLock(&Pool.Lock);
+		Pool.BytesInUse -= AllocatedSize;
+	}
+}
+
+int64 FECFCoroutineAllocator::GetBytesInUse()
+{
+	ECFCoroutineAllocator::FPool& Pool = ECFCoroutineAllocator::GetPool();
+	FScopeLock ScopeLock(&Pool.Lock);
+	return Pool.BytesInUse;
+}
+
+int64 FECFCoroutineAllocator::GetBytesReserved()
+{
+	ECFCoroutineAllocator::FPool& Pool = ECFCoroutineAllocator::GetPool();
+	FScopeLock ScopeLock(&Pool.Lock);
+	return Pool.BytesReserved;
+}
+
+void FECFCoroutineAllocator::ReleaseUnusedMemory()
+{
+	using namespace ECFCoroutineAllocator;
+
+	FPool& Pool = GetPool();
+	FScopeLock ScopeLock(&Pool.Lock);
+
+	// Chunks don't count their used slots and their free slots are linked into the bucket's free list together with slots of other chunks.
+	// A single chunk can't be taken out of the list, so chunks can be freed only all at once, when no frame is using the pool.
+	if (Pool.PooledBytesInUse == 0)
+	{
+		for (void* Chunk : Pool.Chunks)
+		{
+			FMemory::Free(Chunk);
+		}
+
+#if STATS
+		DEC_MEMORY_STAT_BY(STAT_ECF_CoroutineFramesPoolMemory, Pool.BytesReserved);
+#endif
+
+		Pool.Chunks.Empty();
+		Pool.BytesReserved = 0;
+		for (int32 BucketId = 0; BucketId < BucketsNum; BucketId++)
+		{
+			Pool.FreeSlots[BucketId] = nullptr;
+		}
+	}
+}
+
+ECF_PRAGMA_ENABLE_OPTIMIZATION
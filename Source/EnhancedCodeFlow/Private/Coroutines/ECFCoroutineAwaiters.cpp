@@ -5,7 +5,10 @@
 #include "CodeFlowActions/Coroutines/ECFWaitSeconds.h"
 #include "CodeFlowActions/Coroutines/ECFWaitTicks.h"
 #include "CodeFlowActions/Coroutines/ECFWaitUntil.h"
+#include "CodeFlowActions/Coroutines/ECFWaitForDelegate.h"
 #include "CodeFlowActions/Coroutines/ECFRunAsyncAndWait.h"
+#include "CodeFlowActions/Coroutines/ECFWhenAllAny.h"
+#include "Async/Async.h"
 
 ECF_PRAGMA_DISABLE_OPTIMIZATION
 
@@ -20,7 +23,12 @@ FECFCoroutineAwaiter_WaitSeconds::FECFCoroutineAwaiter_WaitSeconds(const UObject
 
 void FECFCoroutineAwaiter_WaitSeconds::await_suspend(FECFCoroutineHandle CoroHandle)
 {
-	AddCoroutineAction<UECFWaitSeconds>(Owner, CoroHandle, Settings, Time);
+	AddCoroutineTimer<UECFWaitSeconds>(Owner, CoroHandle, Settings, EECFCoroutineTimerType::Seconds, Time);
+}
+
+TUniquePtr<FECFWaitCondition> FECFCoroutineAwaiter_WaitSeconds::MakeCondition()
+{
+	return MakeUnique<FECFWaitCondition_WaitSeconds>(Time);
 }
 
 /*^^^ Wait Ticks Coroutine Awaiter ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^*/
@@ -34,7 +42,25 @@ FECFCoroutineAwaiter_WaitTicks::FECFCoroutineAwaiter_WaitTicks(const UObject* In
 
 void FECFCoroutineAwaiter_WaitTicks::await_suspend(FECFCoroutineHandle CoroHandle)
 {
-	AddCoroutineAction<UECFWaitTicks>(Owner, CoroHandle, Settings, Ticks);
+	AddCoroutineTimer<UECFWaitTicks>(Owner, CoroHandle, Settings, EECFCoroutineTimerType::Ticks, Ticks);
+}
+
+TUniquePtr<FECFWaitCondition> FECFCoroutineAwaiter_WaitTicks::MakeCondition()
+{
+	return MakeUnique<FECFWaitCondition_WaitTicks>(Ticks);
+}
+
+/*^^^ Yield Coroutine Awaiter ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^*/
+
+FECFCoroutineAwaiter_Yield::FECFCoroutineAwaiter_Yield(const UObject* InOwner)
+{
+	Owner = InOwner;
+}
+
+void FECFCoroutineAwaiter_Yield::await_suspend(FECFCoroutineHandle CoroHandle)
+{
+	// When the scheduler is disabled, waiting for 0 ticks also resumes the coroutine in the next frame.
+	AddCoroutineTimer<UECFWaitTicks>(Owner, CoroHandle, Settings, EECFCoroutineTimerType::Yield, 0);
 }
 
 /*^^^ Wait Until Coroutine Awaiter ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^*/
@@ -52,20 +78,126 @@ void FECFCoroutineAwaiter_WaitUntil::await_suspend(FECFCoroutineHandle CoroHandl
 	AddCoroutineAction<UECFWaitUntil>(Owner, CoroHandle, Settings, MoveTemp(Predicate), TimeOut);
 }
 
+TUniquePtr<FECFWaitCondition> FECFCoroutineAwaiter_WaitUntil::MakeCondition()
+{
+	return MakeUnique<FECFWaitCondition_WaitUntil>(MoveTemp(Predicate), TimeOut);
+}
+
 /*^^^ Run Async And Wait Coroutine Awaiter ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^*/
 
-FECFCoroutineAwaiter_RunAsyncAndWait::FECFCoroutineAwaiter_RunAsyncAndWait(const UObject* InOwner, const FECFActionSettings& InSettings, TUniqueFunction<void()>&& InAsyncTaskFunc, float InTimeOut, EECFAsyncPrio InThreadPriority)
+FECFCoroutineAwaiter_RunAsyncAndWait::FECFCoroutineAwaiter_RunAsyncAndWait(const UObject* InOwner, const FECFActionSettings& InSettings, TUniqueFunction<void(const FECFCancellationToken&)>&& InAsyncTaskFunc, float InTimeOut, const FECFAsyncExecutor& InExecutor)
 {
 	Owner = InOwner;
 	Settings = InSettings;
 	AsyncTaskFunction = MoveTemp(InAsyncTaskFunc);
 	TimeOut = InTimeOut;
-	ThreadPriority = InThreadPriority;
+	Executor = InExecutor;
 }
 
 void FECFCoroutineAwaiter_RunAsyncAndWait::await_suspend(FECFCoroutineHandle CoroHandle)
 {
-	AddCoroutineAction<UECFRunAsyncAndWait>(Owner, CoroHandle, Settings, MoveTemp(AsyncTaskFunction), TimeOut, ThreadPriority);
+	AddCoroutineAction<UECFRunAsyncAndWait>(Owner, CoroHandle, Settings, MoveTemp(AsyncTaskFunction), TimeOut, Executor);
+}
+
+TUniquePtr<FECFWaitCondition> FECFCoroutineAwaiter_RunAsyncAndWait::MakeCondition()
+{
+	return MakeUnique<FECFWaitCondition_RunAsyncAndWait>(MoveTemp(AsyncTaskFunction), TimeOut, Executor);
+}
+
+/*^^^ Resume On Background Coroutine Awaiter ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^*/
+
+FECFCoroutineAwaiter_ResumeOnBackground::FECFCoroutineAwaiter_ResumeOnBackground(const UObject* InOwner, const FECFAsyncExecutor& InExecutor)
+{
+	Owner = InOwner;
+	Executor = InExecutor;
+}
+
+bool FECFCoroutineAwaiter_ResumeOnBackground::await_ready()
+{
+	return IsInGameThread() == false;
+}
+
+void FECFCoroutineAwaiter_ResumeOnBackground::LaunchCoroutine(FECFCoroutineHandle CoroHandle)
+{
+#ifdef __cpp_impl_coroutine
+	// From now on the subsystem won't destroy this coroutine, it will only request to stop it.
+	CoroHandle.promise().bIsOnBackground = true;
+	CoroHandle.promise().bIsStopRequested = false;
+	CoroHandle.promise().BackgroundOwner = Owner;
+
+	// This awaiter lives in the coroutine frame, which can be destroyed by the worker before Launch returns.
+	// Launch with a local copy, so the executor (and it's pipe) stays alive until the task is launched.
+	const FECFAsyncExecutor LaunchExecutor = Executor;
+	LaunchExecutor.Launch([CoroHandle]()
+	{
+		CoroHandle.resume();
+	});
+#endif
+}
+
+/*^^^ Resume On Game Thread Coroutine Awaiter ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^*/
+
+FECFCoroutineAwaiter_ResumeOnGameThread::FECFCoroutineAwaiter_ResumeOnGameThread()
+{
+	Owner = nullptr;
+}
+
+bool FECFCoroutineAwaiter_ResumeOnGameThread::await_ready()
+{
+	return IsInGameThread();
+}
+
+void FECFCoroutineAwaiter_ResumeOnGameThread::ResumeCoroutine(FECFCoroutineHandle CoroHandle)
+{
+#ifdef __cpp_impl_coroutine
+	// The coroutine is resumed as soon as the Game Thread processes it's tasks, without waiting for the subsystem's tick.
+	AsyncTask(ENamedThreads::GameThread, [CoroHandle]()
+	{
+		FECFCoroutinePromiseBase& Promise = CoroHandle.promise();
+		Promise.bIsOnBackground = false;
+		if (Promise.bIsStopRequested || (Promise.BackgroundOwner.IsValid() == false))
+		{
+			Promise.bHasFinished = true;
+			CoroHandle.destroy();
+		}
+		else
+		{
+			CoroHandle.resume();
+		}
+	});
+#endif
+}
+
+/*^^^ Wait For Delegate Coroutine Awaiter ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^*/
+
+FECFCoroutineAwaiter_WaitForDelegate::FECFCoroutineAwaiter_WaitForDelegate(const UObject* InOwner, const FECFActionSettings& InSettings, TUniquePtr<FECFDelegateBinding>&& InBinding, float InTimeOut)
+{
+	Owner = InOwner;
+	Settings = InSettings;
+	Binding = MoveTemp(InBinding);
+	TimeOut = InTimeOut;
+	bTimedOut = MakeShared<bool>(false);
+}
+
+void FECFCoroutineAwaiter_WaitForDelegate::await_suspend(FECFCoroutineHandle CoroHandle)
+{
+	AddCoroutineAction<UECFWaitForDelegate>(Owner, CoroHandle, Settings, MoveTemp(Binding), TimeOut, bTimedOut);
+}
+
+/*^^^ When All/Any Coroutine Awaiter ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^*/
+
+FECFCoroutineAwaiter_WhenAllAny::FECFCoroutineAwaiter_WhenAllAny(const UObject* InOwner, const FECFActionSettings& InSettings, TArray<TUniquePtr<FECFWaitCondition>>&& InConditions, bool bInWaitForAll)
+{
+	Owner = InOwner;
+	Settings = InSettings;
+	Conditions = MoveTemp(InConditions);
+	bWaitForAll = bInWaitForAll;
+	WinnerIndex = MakeShared<int32>(INDEX_NONE);
+}
+
+void FECFCoroutineAwaiter_WhenAllAny::await_suspend(FECFCoroutineHandle CoroHandle)
+{
+	AddCoroutineAction<UECFWhenAllAny>(Owner, CoroHandle, Settings, MoveTemp(Conditions), bWaitForAll, WinnerIndex);
 }
 
 ECF_PRAGMA_ENABLE_OPTIMIZATION
@@ -0,0 +1,278 @@
+// Copyright (c) 2024 Damian Nowakowski. All rights reserved.
+
+#include "Coroutines/ECFCoroutineScheduler.h"
+#include "ECFStats.h"
+#include "Engine/World.h"
+#include "GameFramework/WorldSettings.h"
+#include "HAL/IConsoleManager.h"
+
+ECF_PRAGMA_DISABLE_OPTIMIZATION
+
+static bool GECFCoroutineScheduler = true;
+static FAutoConsoleVariableRef CVarECFCoroutineScheduler(
+	TEXT("ECF.CoroutineScheduler"),
+	GECFCoroutineScheduler,
+	TEXT("If enabled, coroutines suspended by Wait Seconds and Wait Ticks are resumed by the subsystem's timer list instead of coroutine actions."));
+
+static float GECFCoroutineYieldBudget = 0.f;
+static FAutoConsoleVariableRef CVarECFCoroutineYieldBudget(
+	TEXT("ECF.CoroutineYieldBudget"),
+	GECFCoroutineYieldBudget,
+	TEXT("Time in milliseconds which coroutines resumed after co_yield can take in one frame. The rest of them is resumed in the next frames. 0 means no limit."));
+
+bool FECFCoroutineScheduler::IsEnabled()
+{
+	return GECFCoroutineScheduler;
+}
+
+bool FECFCoroutineScheduler::AddTimer(const UObject* InOwner, FECFCoroutineHandle InCoroutineHandle, const FECFActionSettings& InSettings, EECFCoroutineTimerType InType, float InValue)
+{
+	// Tick intervals, starting paused and tick groups need the full action logic.
+	// Negative values are passed to actions too, so they can report the error.
+	if ((IsEnabled() == false) || (InSettings.TickInterval > 0.f) || InSettings.bStartPaused || (InSettings.TickGroup != EECFTickGroup::Default) || (InValue < 0.f) || (InType == EECFCoroutineTimerType::Any))
+	{
+		return false;
+	}
+
+	// Ensure the coroutine has been suspended on the Game Thread.
+	if (IsInGameThread() == false)
+	{
+		checkf(false, TEXT("ECF Coroutines must be started from the Game Thread!"));
+		return true;
+	}
+
+	FTimer& NewTimer = Timers.AddDefaulted_GetRef();
+	NewTimer.CoroutineHandle = InCoroutineHandle;
+	NewTimer.Owner = InOwner;
+	NewTimer.Type = InType;
+	NewTimer.DelayLeft = InSettings.FirstDelay;
+	NewTimer.bIgnorePause = InSettings.bIgnorePause;
+	NewTimer.bIgnoreGlobalTimeDilation = InSettings.bIgnoreGlobalTimeDilation;
+
+	// Wait Ticks resumes in the tick after the given amount of ticks, the same as the Wait Ticks action.
+	NewTimer.Remaining = (InType == EECFCoroutineTimerType::Ticks) ? InValue + 1.f : InValue;
+	NewTimer.YieldFrame = GFrameCounter;
+
+	return true;
+}
+
+void FECFCoroutineScheduler::Tick(UWorld* World, float DeltaTime)
+{
+	// Forget timers removed since the last tick.
+	Timers.RemoveAll([](const FTimer& Timer)
+	{
+		return Timer.State == ETimerState::Removed;
+	});
+
+	if (Timers.Num() == 0)
+	{
+		return;
+	}
+
+#if STATS
+	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("CoroutineScheduler - Tick"), STAT_ECFDETAILS_COROUTINESCHEDULER, STATGROUP_ECFDETAILS);
+#endif
+
+	// The world state is the same for every timer, so check it once.
+	const bool bIsWorldPaused = World && World->IsPaused();
+	float TimeDilation = 1.f;
+	if (World)
+	{
+		if (AWorldSettings* WorldSettings = World->GetWorldSettings())
+		{
+			TimeDilation = WorldSettings->TimeDilation;
+		}
+	}
+
+	for (FTimer& Timer : Timers)
+	{
+		// Yielded coroutines are resumed after the others, within the yield budget.
+		if ((Timer.State != ETimerState::Running) || (Timer.Type == EECFCoroutineTimerType::Yield))
+		{
+			continue;
+		}
+
+		if (Timer.Owner.IsValid() == false)
+		{
+			Timer.State = ETimerState::Removed;
+			DestroyCoroutine(Timer.CoroutineHandle);
+			continue;
+		}
+
+		if ((Timer.bIgnorePause == false) && bIsWorldPaused)
+		{
+			continue;
+		}
+
+		const float TimerDeltaTime = Timer.bIgnoreGlobalTimeDilation ? DeltaTime : DeltaTime * TimeDilation;
+		if (Timer.DelayLeft > 0.f)
+		{
+			Timer.DelayLeft -= TimerDeltaTime;
+		}
+		else if (Timer.Type == EECFCoroutineTimerType::Ticks)
+		{
+			Timer.Remaining -= 1.f;
+			if (Timer.Remaining <= 0.f)
+			{
+				Timer.State = ETimerState::Ended;
+			}
+		}
+		else
+		{
+			Timer.Remaining -= TimerDeltaTime;
+			if (Timer.Remaining < 0.f)
+			{
+				Timer.State = ETimerState::Ended;
+			}
+		}
+	}
+
+	// Timers added by resumed coroutines will be ticked in the next frame.
+	ResumeEndedTimers();
+	ResumeYieldedTimers(bIsWorldPaused);
+}
+
+void FECFCoroutineScheduler::RemoveTimers(EECFCoroutineTimerType InType, bool bComplete, const UObject* InOwner)
+{
+	for (FTimer& Timer : Timers)
+	{
+		if ((Timer.State == ETimerState::Running) && ((InType == EECFCoroutineTimerType::Any) || (InType == Timer.Type)) && ((InOwner == nullptr) || (InOwner == Timer.Owner.Get())))
+		{
+			if (bComplete)
+			{
+				Timer.State = ETimerState::Ended;
+			}
+			else
+			{
+				// Stopped coroutines without completion are never resumed, the same as when their actions are stopped.
+				Timer.State = ETimerState::Removed;
+				if (Timer.Owner.IsValid())
+				{
+					Timer.CoroutineHandle.promise().bIsSuspended = false;
+				}
+				else
+				{
+					DestroyCoroutine(Timer.CoroutineHandle);
+				}
+			}
+		}
+	}
+
+	if (bComplete)
+	{
+		ResumeEndedTimers();
+	}
+}
+
+void FECFCoroutineScheduler::ForgetCoroutine(const FECFCoroutinePromiseBase& Promise)
+{
+	for (FTimer& Timer : Timers)
+	{
+		if ((Timer.State != ETimerState::Removed) && (&Timer.CoroutineHandle.promise() == &Promise))
+		{
+			Timer.State = ETimerState::Removed;
+		}
+	}
+}
+
+void FECFCoroutineScheduler::DestroyCoroutines(const UObject* InOwner)
+{
+	for (FTimer& Timer : Timers)
+	{
+		if ((Timer.State != ETimerState::Removed) && ((InOwner == nullptr) || (InOwner == Timer.Owner.Get())))
+		{
+			Timer.State = ETimerState::Removed;
+			DestroyCoroutine(Timer.CoroutineHandle);
+		}
+	}
+}
+
+void FECFCoroutineScheduler::Reset()
+{
+	// The subsystem is going away, nothing will resume these coroutines anymore.
+	DestroyCoroutines(nullptr);
+	Timers.Empty();
+}
+
+int32 FECFCoroutineScheduler::Num() const
+{
+	int32 ActiveTimersNum = 0;
+	for (const FTimer& Timer : Timers)
+	{
+		if (Timer.State != ETimerState::Removed)
+		{
+			ActiveTimersNum++;
+		}
+	}
+	return ActiveTimersNum;
+}
+
+void FECFCoroutineScheduler::ResumeEndedTimers()
+{
+	// Resumed coroutines can add new timers, so the list can't be iterated with references.
+	for (int32 TimerId = 0; TimerId < Timers.Num(); TimerId++)
+	{
+		if (Timers[TimerId].State == ETimerState::Ended)
+		{
+			Timers[TimerId].State = ETimerState::Removed;
+			FECFCoroutineHandle CoroutineHandle = Timers[TimerId].CoroutineHandle;
+			if (Timers[TimerId].Owner.IsValid())
+			{
+				CoroutineHandle.resume();
+			}
+			else
+			{
+				DestroyCoroutine(CoroutineHandle);
+			}
+		}
+	}
+}
+
+void FECFCoroutineScheduler::ResumeYieldedTimers(bool bIsWorldPaused)
+{
+	const double BudgetSeconds = GECFCoroutineYieldBudget / 1000.0;
+	const double StartTime = FPlatformTime::Seconds();
+
+	// Coroutines yielding again are added at the end of the list with the current frame, so they are skipped until the next frame.
+	// Coroutines skipped because of the budget stay in front of them, so they are resumed first in the next frame.
+	for (int32 TimerId = 0; TimerId < Timers.Num(); TimerId++)
+	{
+		if ((Timers[TimerId].State != ETimerState::Running) || (Timers[TimerId].Type != EECFCoroutineTimerType::Yield) || (Timers[TimerId].YieldFrame == GFrameCounter))
+		{
+			continue;
+		}
+
+		if ((Timers[TimerId].bIgnorePause == false) && bIsWorldPaused && Timers[TimerId].Owner.IsValid())
+		{
+			continue;
+		}
+
+		if ((BudgetSeconds > 0.0) && (FPlatformTime::Seconds() - StartTime >= BudgetSeconds))
+		{
+			break;
+		}
+
+		Timers[TimerId].State = ETimerState::Removed;
+		FECFCoroutineHandle CoroutineHandle = Timers[TimerId].CoroutineHandle;
+		if (Timers[TimerId].Owner.IsValid())
+		{
+			CoroutineHandle.resume();
+		}
+		else
+		{
+			DestroyCoroutine(CoroutineHandle);
+		}
+	}
+}
+
+void FECFCoroutineScheduler::DestroyCoroutine(FECFCoroutineHandle CoroutineHandle)
+{
+	if (CoroutineHandle.promise().bHasFinished == false)
+	{
+		CoroutineHandle.promise().bIsSuspended = false;
+		CoroutineHandle.promise().bHasFinished = true;
+		CoroutineHandle.destroy();
+	}
+}
+
+ECF_PRAGMA_ENABLE_OPTIMIZATION
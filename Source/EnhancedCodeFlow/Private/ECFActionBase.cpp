@@ -4,15 +4,52 @@
 
 #include "ECFActionBase.h"
 #include "ECFStats.h"
+#include "HAL/IConsoleManager.h"
+#include "UObject/UObjectIterator.h"
 
 ECF_PRAGMA_DISABLE_OPTIMIZATION
 
 DEFINE_STAT(STAT_ECF_ActionsObjectsCount);
+DEFINE_STAT(STAT_ECF_ActionsMemory);
+DEFINE_STAT(STAT_ECF_HeapCallbacksCount);
+
+DEFINE_LOG_CATEGORY_STATIC(LogECFActions, Log, All);
+
+static void ReportActionSizes()
+{
+	// Native classes have the size of their C++ objects as their properties size.
+	TArray<UClass*> ActionClasses;
+	for (TObjectIterator<UClass> It; It; ++It)
+	{
+		if (It->IsChildOf(UECFActionBase::StaticClass()) && (It->HasAnyClassFlags(CLASS_Abstract) == false))
+		{
+			ActionClasses.Add(*It);
+		}
+	}
+
+	ActionClasses.Sort([](const UClass& A, const UClass& B)
+	{
+		return A.GetPropertiesSize() > B.GetPropertiesSize();
+	});
+
+	UE_LOG(LogECFActions, Log, TEXT("ECF - Sizes of action classes (UECFActionBase: %d bytes):"), UECFActionBase::StaticClass()->GetPropertiesSize());
+	for (const UClass* ActionClass : ActionClasses)
+	{
+		UE_LOG(LogECFActions, Log, TEXT("  %s: %d bytes"), *ActionClass->GetName(), ActionClass->GetPropertiesSize());
+	}
+}
+
+static FAutoConsoleCommand CmdECFStatsActionSizes(
+	TEXT("ECF.Stats.ActionSizes"),
+	TEXT("Logs the size in bytes of every ECF action class, without the memory allocated by it's callbacks."),
+	FConsoleCommandDelegate::CreateStatic(&ReportActionSizes));
 
 UECFActionBase::UECFActionBase()
 {
 #if STATS
 	INC_DWORD_STAT(STAT_ECF_ActionsObjectsCount);
+	StatMemorySize = GetClass()->GetPropertiesSize();
+	INC_MEMORY_STAT_BY(STAT_ECF_ActionsMemory, StatMemorySize);
 #endif
 }
 
@@ -20,6 +57,7 @@ UECFActionBase::~UECFActionBase()
 {
 #if STATS
 	DEC_DWORD_STAT(STAT_ECF_ActionsObjectsCount);
+	DEC_MEMORY_STAT_BY(STAT_ECF_ActionsMemory, StatMemorySize);
 #endif
 }
 
@@ -0,0 +1,91 @@
+// Copyright (c) 2024 Damian Nowakowski. All rights reserved.
+
+#include "ECFAsyncExecutor.h"
+#include "Async/Async.h"
+#include "Misc/QueuedThreadPool.h"
+
+ECF_PRAGMA_DISABLE_OPTIMIZATION
+
+FECFAsyncExecutor::FECFAsyncExecutor(EECFAsyncPrio InThreadPriority/* = EECFAsyncPrio::Normal*/)
+{
+	switch (InThreadPriority)
+	{
+		case EECFAsyncPrio::Normal:
+			ThreadType = ENamedThreads::AnyBackgroundThreadNormalTask;
+			break;
+		case EECFAsyncPrio::HiPriority:
+			ThreadType = ENamedThreads::AnyBackgroundHiPriTask;
+			break;
+	}
+}
+
+FECFAsyncExecutor FECFAsyncExecutor::ThreadPool(FQueuedThreadPool* InThreadPool)
+{
+	FECFAsyncExecutor Executor;
+	if (InThreadPool)
+	{
+		Executor.ExecutorType = EExecutorType::ThreadPool;
+		Executor.QueuedThreadPool = InThreadPool;
+	}
+	else
+	{
+		ensureMsgf(false, TEXT("ECF - Async executor got an invalid thread pool. The task graph will be used instead."));
+	}
+	return Executor;
+}
+
+#if (ENGINE_MAJOR_VERSION == 5)
+
+FECFAsyncExecutor FECFAsyncExecutor::Tasks(UE::Tasks::ETaskPriority InTaskPriority)
+{
+	FECFAsyncExecutor Executor;
+	Executor.ExecutorType = EExecutorType::Tasks;
+	Executor.TaskPriority = InTaskPriority;
+	return Executor;
+}
+
+FECFAsyncExecutor FECFAsyncExecutor::Pipe(const TSharedPtr<UE::Tasks::FPipe, ESPMode::ThreadSafe>& InPipe, UE::Tasks::ETaskPriority InTaskPriority/* = UE::Tasks::ETaskPriority::Normal*/)
+{
+	FECFAsyncExecutor Executor;
+	if (InPipe.IsValid())
+	{
+		Executor.ExecutorType = EExecutorType::Pipe;
+		Executor.TaskPipe = InPipe;
+		Executor.TaskPriority = InTaskPriority;
+	}
+	else
+	{
+		ensureMsgf(false, TEXT("ECF - Async executor got an invalid pipe. The task graph will be used instead."));
+	}
+	return Executor;
+}
+
+TSharedPtr<UE::Tasks::FPipe, ESPMode::ThreadSafe> FECFAsyncExecutor::MakePipe(const TCHAR* InDebugName)
+{
+	return MakeShared<UE::Tasks::FPipe, ESPMode::ThreadSafe>(InDebugName);
+}
+
+#endif
+
+void FECFAsyncExecutor::Launch(TUniqueFunction<void()>&& InTask) const
+{
+	switch (ExecutorType)
+	{
+		case EExecutorType::ThreadPool:
+			AsyncPool(*QueuedThreadPool, MoveTemp(InTask));
+			break;
+#if (ENGINE_MAJOR_VERSION == 5)
+		case EExecutorType::Tasks:
+			UE::Tasks::Launch(TEXT("ECF Async Task"), MoveTemp(InTask), TaskPriority);
+			break;
+		case EExecutorType::Pipe:
+			TaskPipe->Launch(TEXT("ECF Async Task"), MoveTemp(InTask), TaskPriority);
+			break;
+#endif
+		default:
+			AsyncTask(ThreadType, MoveTemp(InTask));
+			break;
+	}
+}
+
+ECF_PRAGMA_ENABLE_OPTIMIZATION
@@ -0,0 +1,99 @@
+// Copyright (c) 2024 Damian Nowakowski. All rights reserved.
+
+#include "ECFAsyncGraph.h"
+
+ECF_PRAGMA_DISABLE_OPTIMIZATION
+
+int32 FECFAsyncGraph::AddStage(TUniqueFunction<void(const FECFCancellationToken&)>&& InStageFunc, const TArray<int32>& InPrerequisites/* = {}*/, const FECFAsyncExecutor& InExecutor/* = EECFAsyncPrio::Normal*/)
+{
+	const int32 StageId = Stages.Num();
+
+	if (InStageFunc)
+	{
+		for (int32 PrerequisiteId : InPrerequisites)
+		{
+			if ((PrerequisiteId < 0) || (PrerequisiteId >= StageId))
+			{
+				ensureMsgf(false, TEXT("ECF - Async Graph stage %d has invalid prerequisite %d. Prerequisites must be stages added before it."), StageId, PrerequisiteId);
+				bIsValid = false;
+				return INDEX_NONE;
+			}
+		}
+	}
+	else
+	{
+		ensureMsgf(false, TEXT("ECF - Async Graph stage %d has no function."), StageId);
+		bIsValid = false;
+		return INDEX_NONE;
+	}
+
+	FStage& NewStage = Stages.AddDefaulted_GetRef();
+	NewStage.StageFunc = MoveTemp(InStageFunc);
+	NewStage.Executor = InExecutor;
+
+	// Duplicated prerequisites would never let the stage start.
+	for (int32 PrerequisiteId : TSet<int32>(InPrerequisites))
+	{
+		Stages[PrerequisiteId].Dependents.Add(StageId);
+		NewStage.PrerequisitesNum++;
+	}
+
+	return StageId;
+}
+
+int32 FECFAsyncGraph::AddStage(TUniqueFunction<void()>&& InStageFunc, const TArray<int32>& InPrerequisites/* = {}*/, const FECFAsyncExecutor& InExecutor/* = EECFAsyncPrio::Normal*/)
+{
+	return AddStage(FECFCancellationToken::AdaptTaskFunc(MoveTemp(InStageFunc)), InPrerequisites, InExecutor);
+}
+
+void FECFAsyncGraph::Launch(const TSharedRef<FECFAsyncGraph, ESPMode::ThreadSafe>& InGraph, const FECFCancellationToken& InToken, TUniqueFunction<void()>&& InOnFinished)
+{
+	InGraph->Token = InToken;
+	InGraph->OnFinished = MoveTemp(InOnFinished);
+	InGraph->PendingStages = InGraph->Stages.Num();
+
+	InGraph->PendingPrerequisites.SetNumUninitialized(InGraph->Stages.Num());
+	for (int32 StageId = 0; StageId < InGraph->Stages.Num(); StageId++)
+	{
+		InGraph->PendingPrerequisites[StageId] = InGraph->Stages[StageId].PrerequisitesNum;
+	}
+
+	// Stages without prerequisites can start right away.
+	// The rest of them are launched by the workers which end their last prerequisite.
+	for (int32 StageId = 0; StageId < InGraph->Stages.Num(); StageId++)
+	{
+		if (InGraph->Stages[StageId].PrerequisitesNum == 0)
+		{
+			LaunchStage(InGraph, StageId);
+		}
+	}
+}
+
+void FECFAsyncGraph::LaunchStage(const TSharedRef<FECFAsyncGraph, ESPMode::ThreadSafe>& InGraph, int32 StageId)
+{
+	InGraph->Stages[StageId].Executor.Launch([InGraph, StageId]()
+	{
+		FStage& Stage = InGraph->Stages[StageId];
+
+		// Cancelled stages are skipped, but they still release their dependents, so the graph always finishes.
+		if (InGraph->Token.IsCancelled() == false)
+		{
+			Stage.StageFunc(InGraph->Token);
+		}
+
+		for (int32 DependentId : Stage.Dependents)
+		{
+			if (FPlatformAtomics::InterlockedDecrement(&InGraph->PendingPrerequisites[DependentId]) == 0)
+			{
+				LaunchStage(InGraph, DependentId);
+			}
+		}
+
+		if (FPlatformAtomics::InterlockedDecrement(&InGraph->PendingStages) == 0)
+		{
+			InGraph->OnFinished();
+		}
+	});
+}
+
+ECF_PRAGMA_ENABLE_OPTIMIZATION
@@ -0,0 +1,104 @@
+// Copyright (c) 2024 Damian Nowakowski. All rights reserved.
+
+#include "ECFPackedActionSettings.h"
+
+ECF_PRAGMA_DISABLE_OPTIMIZATION
+
+const FECFPackedActionSettings::FProfile& FECFPackedActionSettings::GetDefaultProfile()
+{
+	static const FProfile DefaultProfile = FProfile();
+	return DefaultProfile;
+}
+
+TMap<FECFPackedActionSettings::FValues, TUniquePtr<FECFPackedActionSettings::FProfile>>& FECFPackedActionSettings::GetProfiles()
+{
+	static TMap<FValues, TUniquePtr<FProfile>> Profiles;
+	return Profiles;
+}
+
+FECFPackedActionSettings::FECFPackedActionSettings() :
+	Profile(&GetDefaultProfile())
+{}
+
+FECFPackedActionSettings::FECFPackedActionSettings(const FECFActionSettings& InSettings)
+{
+	FValues Values;
+	Values.TickInterval = InSettings.TickInterval;
+	Values.FirstDelay = InSettings.FirstDelay;
+	Values.Flags = static_cast<uint8>((InSettings.bIgnorePause ? Flag_IgnorePause : 0) | (InSettings.bIgnoreGlobalTimeDilation ? Flag_IgnoreGlobalTimeDilation : 0) | (InSettings.bStartPaused ? Flag_StartPaused : 0));
+	Values.TickGroup = InSettings.TickGroup;
+	Profile = AcquireProfile(Values);
+}
+
+FECFPackedActionSettings::FECFPackedActionSettings(const FECFPackedActionSettings& Other) :
+	Profile(AcquireProfile(Other.Profile->Values))
+{}
+
+FECFPackedActionSettings& FECFPackedActionSettings::operator=(const FECFPackedActionSettings& Other)
+{
+	if (Profile != Other.Profile)
+	{
+		const FProfile* OldProfile = Profile;
+		Profile = AcquireProfile(Other.Profile->Values);
+		ReleaseProfile(OldProfile);
+	}
+	return *this;
+}
+
+FECFPackedActionSettings::~FECFPackedActionSettings()
+{
+	ReleaseProfile(Profile);
+}
+
+bool FECFPackedActionSettings::IsDefault() const
+{
+	return Profile == &GetDefaultProfile();
+}
+
+FECFActionSettings FECFPackedActionSettings::Unpack() const
+{
+	return FECFActionSettings(GetTickInterval(), GetFirstDelay(), IgnoresPause(), IgnoresGlobalTimeDilation(), StartsPaused(), GetTickGroup());
+}
+
+int32 FECFPackedActionSettings::GetProfilesNum()
+{
+	return GetProfiles().Num();
+}
+
+const FECFPackedActionSettings::FProfile* FECFPackedActionSettings::AcquireProfile(const FValues& InValues)
+{
+	if (InValues == GetDefaultProfile().Values)
+	{
+		return &GetDefaultProfile();
+	}
+
+	check(IsInGameThread());
+
+	TUniquePtr<FProfile>& FoundProfile = GetProfiles().FindOrAdd(InValues);
+	if (FoundProfile.IsValid() == false)
+	{
+		FoundProfile = MakeUnique<FProfile>();
+		FoundProfile->Values = InValues;
+	}
+	FoundProfile->RefCount++;
+	return FoundProfile.Get();
+}
+
+void FECFPackedActionSettings::ReleaseProfile(const FProfile* InProfile)
+{
+	if (InProfile == &GetDefaultProfile())
+	{
+		return;
+	}
+
+	check(IsInGameThread());
+
+	// Profiles are only changed through the map, the pointer is const only for the settings users.
+	FProfile* ReleasedProfile = const_cast<FProfile*>(InProfile);
+	if (--ReleasedProfile->RefCount <= 0)
+	{
+		GetProfiles().Remove(InProfile->Values);
+	}
+}
+
+ECF_PRAGMA_ENABLE_OPTIMIZATION
@@ -2,6 +2,7 @@
 
 #include "ECFSubsystem.h"
 #include "ECFActionBase.h"
+#include "Coroutines/ECFCoroutineActionBase.h"
 #include "Engine/Engine.h"
 #include "Engine/GameInstance.h"
 
@@ -9,6 +10,9 @@ ECF_PRAGMA_DISABLE_OPTIMIZATION
 
 DEFINE_STAT(STAT_ECF_ActionsCount);
 DEFINE_STAT(STAT_ECF_InstancesCount);
+DEFINE_STAT(STAT_ECF_BatchedTimelinesCount);
+DEFINE_STAT(STAT_ECF_CoroutineTimersCount);
+DEFINE_STAT(STAT_ECF_SettingsProfilesCount);
 
 void UECFSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 {
@@ -28,12 +32,56 @@ void UECFSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 
 	// Reset the HandleId counter
 	LastHandleId.Invalidate();
+
+	AsyncCompletionQueue = MakeShared<FAsyncCompletionQueue, ESPMode::ThreadSafe>();
+
+	// Tick functions are registered only when actions use their tick groups.
+	for (int32 TickGroupId = 0; TickGroupId < TickGroupFunctionsNum; TickGroupId++)
+	{
+		FECFTickGroupFunction& TickFunction = TickGroupFunctions[TickGroupId];
+		TickFunction.Subsystem = this;
+		TickFunction.Group = static_cast<EECFTickGroup>(TickGroupId + 1);
+		TickFunction.TickGroup = FECFTickGroupFunction::ToEngineTickGroup(TickFunction.Group);
+		TickFunction.bCanEverTick = true;
+		TickFunction.bStartWithTickEnabled = true;
+		// The same as the subsystem, the pause is handled by actions.
+		TickFunction.bTickEvenWhenPaused = true;
+	}
 }
 
 void UECFSubsystem::Deinitialize()
 {
+	// Nothing will resume coroutines after the subsystem is gone.
+	StopCoroutines(nullptr);
+
+	for (FECFTickGroupFunction& TickFunction : TickGroupFunctions)
+	{
+		TickFunction.UnRegisterTickFunction();
+	}
+
+	TimelineBatch.Reset();
+	CoroutineScheduler.Reset();
+	AsyncCompletionQueue.Reset();
+
+	for (UECFActionBase* Action : Actions)
+	{
+		if (IsValid(Action))
+		{
+			Action->ActionRemoved();
+		}
+	}
+	for (UECFActionBase* PendingAction : PendingAddActions)
+	{
+		if (IsValid(PendingAction))
+		{
+			PendingAction->ActionRemoved();
+		}
+	}
+
 	Actions.Empty();
 	PendingAddActions.Empty();
+	ActionsByHandle.Empty();
+	PooledBPProxies.Empty();
 }
 
 UECFSubsystem* UECFSubsystem::Get(const UObject* WorldContextObject)
@@ -75,22 +123,65 @@ void UECFSubsystem::Tick(float DeltaTime)
 	TRACE_CPUPROFILER_EVENT_SCOPE_STR("ECF-Actions-Tick");
 #endif
 
+	// Coroutines of destroyed owners must be destroyed before anything tries to resume them
+	DestroyOrphanedCoroutines();
+
+	// Let expired actions know they are being removed (e.g. to cancel their async tasks)
+	auto RemoveExpiredAction = [this](UECFActionBase* Action)
+	{
+		if (IsActionValid(Action) == false)
+		{
+			if (IsValid(Action))
+			{
+				Action->ActionRemoved();
+			}
+			if (Action)
+			{
+				ActionsByHandle.Remove(Action->GetHandleId());
+			}
+			return true;
+		}
+		return false;
+	};
+
 	// Remove all expired actions first
-	Actions.RemoveAll([](UECFActionBase* Action) { return IsActionValid(Action) == false; });
+	Actions.RemoveAll(RemoveExpiredAction);
 
 	// There might be a situation the pending action is invalid too
-	PendingAddActions.RemoveAll([&](UECFActionBase* PendingAddAction) { return IsActionValid(PendingAddAction) == false; });
+	PendingAddActions.RemoveAll(RemoveExpiredAction);
+
+	// Actions nulled by the garbage collector couldn't be removed from the handles map by their handles, so find them there.
+	if (ActionsByHandle.Num() > (Actions.Num() + PendingAddActions.Num()))
+	{
+		for (auto It = ActionsByHandle.CreateIterator(); It; ++It)
+		{
+			if (It->Value.IsValid() == false)
+			{
+				It.RemoveCurrent();
+			}
+		}
+	}
+
+	// Batched timelines must be forgotten together with their actions
+	TimelineBatch.RemoveInvalidTimelines();
 
 	// Add all pending actions
 	Actions.Append(PendingAddActions);
 	PendingAddActions.Empty();
 
+	// Wake up actions which async tasks have finished, so they can complete in this tick
+	ProcessAsyncCompletions();
+
 #if STATS
 	SET_DWORD_STAT(STAT_ECF_ActionsCount, Actions.Num());
 	SET_DWORD_STAT(STAT_ECF_InstancesCount, 0);
+	SET_DWORD_STAT(STAT_ECF_BatchedTimelinesCount, TimelineBatch.Num());
+	SET_DWORD_STAT(STAT_ECF_CoroutineTimersCount, CoroutineScheduler.Num());
+	SET_DWORD_STAT(STAT_ECF_SettingsProfilesCount, FECFPackedActionSettings::GetProfilesNum());
 #endif
 
-	// Tick all active actions
+	// Tick all active actions of the default tick group. Actions of other groups are ticked by tick functions of their groups.
+	bool bUsedTickGroups[TickGroupFunctionsNum] = {};
 	for (UECFActionBase* Action : Actions)
 	{
 		if (IsActionValid(Action))
@@ -101,22 +192,125 @@ void UECFSubsystem::Tick(float DeltaTime)
 				INC_DWORD_STAT(STAT_ECF_InstancesCount);
 			}
 #endif
+			const EECFTickGroup ActionTickGroup = Action->Settings.GetTickGroup();
+			if (ActionTickGroup != EECFTickGroup::Default)
+			{
+				bUsedTickGroups[static_cast<int32>(ActionTickGroup) - 1] = true;
+			}
+			// Actions waiting for an event cost nothing until the event arrives.
+			else if (Action->bIsWaitingForEvent == false)
+			{
+				Action->DoTick(DeltaTime);
+			}
+		}
+	}
+
+	// Actions added during the tick above are not in the list yet, but their groups are used too.
+	for (UECFActionBase* PendingAction : PendingAddActions)
+	{
+		if (IsActionValid(PendingAction) && (PendingAction->Settings.GetTickGroup() != EECFTickGroup::Default))
+		{
+			bUsedTickGroups[static_cast<int32>(PendingAction->Settings.GetTickGroup()) - 1] = true;
+		}
+	}
+	UpdateTickGroups(bUsedTickGroups);
+
+	// Evaluate batched timelines which have been ticked above
+	TimelineBatch.Evaluate();
+
+	// Flush timeline sinks written in this frame
+	TimelineBatch.FlushSinks();
+
+	// Resume coroutines which timers have ended
+	CoroutineScheduler.Tick(GetWorld(), DeltaTime);
+}
+
+void UECFSubsystem::RegisterTickGroup(EECFTickGroup InTickGroup)
+{
+	if ((InTickGroup == EECFTickGroup::Default) || (bCanTick == false))
+	{
+		return;
+	}
+
+	FECFTickGroupFunction& TickFunction = TickGroupFunctions[static_cast<int32>(InTickGroup) - 1];
+	if (TickFunction.IsTickFunctionRegistered() == false)
+	{
+		// Tick functions are unregistered when their level goes away (e.g. after travel), so they are registered in the current one.
+		UWorld* ThisWorld = GetWorld();
+		if (ThisWorld && ThisWorld->PersistentLevel)
+		{
+			TickFunction.RegisterTickFunction(ThisWorld->PersistentLevel);
+		}
+	}
+}
+
+void UECFSubsystem::UpdateTickGroups(const bool (&bUsedTickGroups)[TickGroupFunctionsNum])
+{
+	for (int32 TickGroupId = 0; TickGroupId < TickGroupFunctionsNum; TickGroupId++)
+	{
+		if (bUsedTickGroups[TickGroupId])
+		{
+			RegisterTickGroup(static_cast<EECFTickGroup>(TickGroupId + 1));
+		}
+		else if (TickGroupFunctions[TickGroupId].IsTickFunctionRegistered())
+		{
+			TickGroupFunctions[TickGroupId].UnRegisterTickFunction();
+		}
+	}
+}
+
+void UECFSubsystem::TickActionsInGroup(EECFTickGroup InTickGroup, float DeltaTime)
+{
+	// Do nothing when the whole subsystem is paused
+	if (bIsECFPaused)
+	{
+		return;
+	}
+
+#if STATS
+	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("Tick Group"), STAT_ECF_TickGroup, STATGROUP_ECF);
+#endif
+
+#if ECF_INSIGHT_PROFILING
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR("ECF-Actions-TickGroup");
+#endif
+
+	// New actions are added and expired actions are removed by the subsystem's tick, so the list doesn't change here.
+	for (UECFActionBase* Action : Actions)
+	{
+		if (IsActionValid(Action) && (Action->bIsWaitingForEvent == false) && (Action->Settings.GetTickGroup() == InTickGroup))
+		{
 			Action->DoTick(DeltaTime);
 		}
 	}
+
+	// Flush timeline sinks written in this tick group
+	TimelineBatch.FlushSinks();
 }
 
-UECFActionBase* UECFSubsystem::FindAction(const FECFHandle& HandleId) const
+void UECFSubsystem::ProcessAsyncCompletions()
 {
-	if (HandleId.IsValid())
+	FECFHandle CompletedHandleId;
+	while (AsyncCompletionQueue->Dequeue(CompletedHandleId))
 	{
-		if (UECFActionBase* const* ActionFound = Actions.FindByPredicate([&](UECFActionBase* Action) { return (IsActionValid(Action) && (Action->GetHandleId() == HandleId)); }))
+		if (UECFActionBase* ActionFound = FindAction(CompletedHandleId))
 		{
-			return *ActionFound;
+			ActionFound->AsyncTaskFinished();
 		}
-		else if (UECFActionBase* const* PendingActionFound = PendingAddActions.FindByPredicate([&](UECFActionBase* PendingAddAction) { return (IsActionValid(PendingAddAction) && (PendingAddAction->GetHandleId() == HandleId)); }))
+	}
+}
+
+UECFActionBase* UECFSubsystem::FindAction(const FECFHandle& HandleId) const
+{
+	if (HandleId.IsValid())
+	{
+		if (const TWeakObjectPtr<UECFActionBase>* ActionFound = ActionsByHandle.Find(HandleId))
 		{
-			return *PendingActionFound;
+			UECFActionBase* Action = ActionFound->Get();
+			if (IsActionValid(Action))
+			{
+				return Action;
+			}
 		}
 	}
 	return nullptr;
@@ -217,6 +411,9 @@ void UECFSubsystem::RemoveInstancedAction(const FECFInstanceId& InstanceId, bool
 
 void UECFSubsystem::RemoveAllActions(bool bComplete, UObject* InOwner)
 {
+	// Coroutines waiting in the scheduler are stopped together with actions.
+	CoroutineScheduler.RemoveTimers(EECFCoroutineTimerType::Any, bComplete, InOwner);
+
 	// Stop all running and pending actions.
 	for (UECFActionBase* Action : Actions)
 	{
@@ -278,6 +475,160 @@ void UECFSubsystem::FinishAction(UECFActionBase* Action, bool bComplete)
 	}
 }
 
+FECFHandle UECFSubsystem::StartCoroutine(const UObject* InOwner, TUniqueFunction<FECFCoroutine()>&& InCoroutineFunc)
+{
+#ifdef __cpp_impl_coroutine
+	// Ensure the coroutine has been started from the Game Thread.
+	if (IsInGameThread() == false)
+	{
+		checkf(false, TEXT("ECF Coroutines must be started from the Game Thread!"));
+		return FECFHandle();
+	}
+
+	if (!InCoroutineFunc)
+	{
+		ensureMsgf(false, TEXT("ECF - Start Coroutine failed. Are you sure the Coroutine Function is set properly?"));
+		return FECFHandle();
+	}
+
+	// The coroutine runs until it's first suspension inside the function, so it must be tracked before it is called.
+	// The first ECF coroutine created by the function takes the launch.
+	const FECFHandle NewHandleId = ++LastHandleId;
+	TrackedCoroutines.Add({ NewHandleId, InOwner, {} });
+
+	FECFCoroutineLaunch Launch;
+	Launch.Observer = this;
+	Launch.HandleId = NewHandleId;
+
+	FECFCoroutineLaunch*& CurrentLaunch = FECFCoroutineLaunch::Current();
+	FECFCoroutineLaunch* PreviousLaunch = CurrentLaunch;
+	CurrentLaunch = &Launch;
+	FECFCoroutine NewCoroutine = InCoroutineFunc();
+	CurrentLaunch = PreviousLaunch;
+
+	if (Launch.bHasStarted == false)
+	{
+		TrackedCoroutines.RemoveAll([&NewHandleId](const FTrackedCoroutine& Coroutine) { return Coroutine.HandleId == NewHandleId; });
+		ensureMsgf(false, TEXT("ECF - Start Coroutine failed. Are you sure the Coroutine Function returns a new FECFCoroutine?"));
+		return FECFHandle();
+	}
+
+	// If the coroutine has already ended it is no longer tracked, but it's handle is still valid.
+	if (FTrackedCoroutine* Tracked = TrackedCoroutines.FindByPredicate([&NewHandleId](const FTrackedCoroutine& Coroutine) { return Coroutine.HandleId == NewHandleId; }))
+	{
+		Tracked->CoroutineHandle = NewCoroutine;
+	}
+
+	return NewHandleId;
+#else
+	ensureMsgf(false, TEXT("ECF - Start Coroutine failed. Coroutines are not supported by the compiler."));
+	return FECFHandle();
+#endif
+}
+
+bool UECFSubsystem::HasCoroutine(const FECFHandle& HandleId) const
+{
+	return HandleId.IsValid() && TrackedCoroutines.ContainsByPredicate([&HandleId](const FTrackedCoroutine& Coroutine) { return Coroutine.HandleId == HandleId; });
+}
+
+void UECFSubsystem::StopCoroutine(FECFHandle& HandleId)
+{
+	// Coroutines which are being launched right now can't be stopped, because they are still running.
+	const int32 TrackedIndex = TrackedCoroutines.IndexOfByPredicate([&HandleId](const FTrackedCoroutine& Coroutine) { return (Coroutine.HandleId == HandleId) && Coroutine.CoroutineHandle.IsValid(); });
+	if (HandleId.IsValid() && (TrackedIndex != INDEX_NONE))
+	{
+		FECFCoroutineHandle CoroutineHandle = TrackedCoroutines[TrackedIndex].CoroutineHandle;
+		TrackedCoroutines.RemoveAt(TrackedIndex);
+
+		// The action or timer which suspended the coroutine will be notified by it's promise.
+		// The coroutine running on a worker thread can't be destroyed now, it will be destroyed when it's back on the Game Thread.
+		CoroutineHandle.promise().TrackedHandleId.Invalidate();
+		if (CoroutineHandle.promise().bIsOnBackground)
+		{
+			CoroutineHandle.promise().bIsStopRequested = true;
+		}
+		else if (CoroutineHandle.promise().bHasFinished == false)
+		{
+			CoroutineHandle.promise().bHasFinished = true;
+			CoroutineHandle.destroy();
+		}
+		HandleId.Invalidate();
+	}
+}
+
+void UECFSubsystem::StopCoroutines(const UObject* InOwner)
+{
+	// Destroying a coroutine can destroy other ones (e.g. coroutines awaiting tasks), so the list is searched again every time.
+	while (FTrackedCoroutine* Tracked = TrackedCoroutines.FindByPredicate([InOwner](const FTrackedCoroutine& Coroutine) { return Coroutine.CoroutineHandle.IsValid() && ((InOwner == nullptr) || (InOwner == Coroutine.Owner.Get())); }))
+	{
+		FECFHandle HandleId = Tracked->HandleId;
+		StopCoroutine(HandleId);
+	}
+
+	// Coroutines suspended by actions and timers.
+	CoroutineScheduler.DestroyCoroutines(InOwner);
+	auto DestroyActionCoroutine = [InOwner](UECFActionBase* Action)
+	{
+		if (UECFCoroutineActionBase* CoroutineAction = Cast<UECFCoroutineActionBase>(Action))
+		{
+			if (IsActionValid(CoroutineAction) && ((InOwner == nullptr) || (InOwner == CoroutineAction->Owner)))
+			{
+				CoroutineAction->DestroyCoroutine();
+			}
+		}
+	};
+	for (UECFActionBase* Action : Actions)
+	{
+		DestroyActionCoroutine(Action);
+	}
+	for (UECFActionBase* PendingAction : PendingAddActions)
+	{
+		DestroyActionCoroutine(PendingAction);
+	}
+}
+
+void UECFSubsystem::DestroyOrphanedCoroutines()
+{
+	while (FTrackedCoroutine* Tracked = TrackedCoroutines.FindByPredicate([](const FTrackedCoroutine& Coroutine) { return Coroutine.CoroutineHandle.IsValid() && (Coroutine.Owner.IsValid() == false); }))
+	{
+		FECFHandle HandleId = Tracked->HandleId;
+		StopCoroutine(HandleId);
+	}
+}
+
+void UECFSubsystem::OnCoroutineDestroyed(FECFCoroutinePromiseBase& Promise)
+{
+	// Nothing can resume this coroutine anymore.
+	if (Promise.bIsSuspended)
+	{
+		CoroutineScheduler.ForgetCoroutine(Promise);
+		auto ForgetActionCoroutine = [&Promise](UECFActionBase* Action)
+		{
+			if (UECFCoroutineActionBase* CoroutineAction = Cast<UECFCoroutineActionBase>(Action))
+			{
+				if (IsActionValid(CoroutineAction))
+				{
+					CoroutineAction->ForgetCoroutine(Promise);
+				}
+			}
+		};
+		for (UECFActionBase* Action : Actions)
+		{
+			ForgetActionCoroutine(Action);
+		}
+		for (UECFActionBase* PendingAction : PendingAddActions)
+		{
+			ForgetActionCoroutine(PendingAction);
+		}
+	}
+
+	if (Promise.TrackedHandleId.IsValid())
+	{
+		const FECFHandle HandleId = Promise.TrackedHandleId;
+		TrackedCoroutines.RemoveAll([&HandleId](const FTrackedCoroutine& Coroutine) { return Coroutine.HandleId == HandleId; });
+	}
+}
+
 bool UECFSubsystem::IsActionValid(UECFActionBase* Action)
 {
 	return IsValid(Action) && (Action->HasAnyFlags(RF_BeginDestroyed | RF_FinishDestroyed) == false) && Action->IsValid();
@@ -0,0 +1,40 @@
+// Copyright (c) 2024 Damian Nowakowski. All rights reserved.
+
+#include "ECFTickGroupFunction.h"
+#include "ECFSubsystem.h"
+#include "Misc/App.h"
+
+ECF_PRAGMA_DISABLE_OPTIMIZATION
+
+void FECFTickGroupFunction::ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent)
+{
+	if (Subsystem)
+	{
+		// The given delta time is already dilated by the world. Actions apply the time dilation themselves (unless they ignore it),
+		// so pass the same undilated delta time the subsystem's tick gets.
+		Subsystem->TickActionsInGroup(Group, FApp::GetDeltaTime());
+	}
+}
+
+FString FECFTickGroupFunction::DiagnosticMessage()
+{
+	return FString::Printf(TEXT("ECF Tick Group %d"), static_cast<int32>(Group));
+}
+
+ETickingGroup FECFTickGroupFunction::ToEngineTickGroup(EECFTickGroup InGroup)
+{
+	switch (InGroup)
+	{
+		case EECFTickGroup::PrePhysics:
+			return TG_PrePhysics;
+		case EECFTickGroup::DuringPhysics:
+			return TG_DuringPhysics;
+		case EECFTickGroup::PostPhysics:
+			return TG_PostPhysics;
+		case EECFTickGroup::PostUpdateWork:
+		default:
+			return TG_PostUpdateWork;
+	}
+}
+
+ECF_PRAGMA_ENABLE_OPTIMIZATION
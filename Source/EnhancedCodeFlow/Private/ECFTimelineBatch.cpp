@@ -0,0 +1,408 @@
+// Copyright (c) 2024 Damian Nowakowski. All rights reserved.
+
+#include "ECFTimelineBatch.h"
+#include "ECFTimelineCore.h"
+#include "ECFTimelineSink.h"
+#include "ECFSubsystem.h"
+#include "ECFStats.h"
+#include "CodeFlowActions/ECFTimeline.h"
+#include "Math/VectorRegister.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Runtime/Launch/Resources/Version.h"
+
+ECF_PRAGMA_DISABLE_OPTIMIZATION
+
+DEFINE_LOG_CATEGORY_STATIC(LogECFTimelineBatch, Log, All);
+
+static bool GECFTimelineBatching = true;
+static FAutoConsoleVariableRef CVarECFTimelineBatching(
+	TEXT("ECF.TimelineBatching"),
+	GECFTimelineBatching,
+	TEXT("If enabled, newly started float timelines are evaluated together by the ECF timeline batch instead of ticking on their own."));
+
+#if (ENGINE_MAJOR_VERSION == 5)
+using FECFVectorRegister = VectorRegister4Float;
+#else
+using FECFVectorRegister = VectorRegister;
+#endif
+
+namespace ECFTimelineBatch
+{
+	// Vectorized versions of the blend functions from TECFBlendFunc.
+	template<EECFBlendFunc BlendFunc>
+	struct TBlend;
+
+	template<>
+	struct TBlend<EECFBlendFunc::ECFBlend_Linear>
+	{
+		static FORCEINLINE FECFVectorRegister Apply(const FECFVectorRegister& Alpha, const FECFVectorRegister& Exp) { return Alpha; }
+	};
+
+	template<>
+	struct TBlend<EECFBlendFunc::ECFBlend_Cubic>
+	{
+		static FORCEINLINE FECFVectorRegister Apply(const FECFVectorRegister& Alpha, const FECFVectorRegister& Exp)
+		{
+			return VectorMultiply(VectorMultiply(Alpha, Alpha), VectorSubtract(VectorSetFloat1(3.f), VectorMultiply(VectorSetFloat1(2.f), Alpha)));
+		}
+	};
+
+	template<>
+	struct TBlend<EECFBlendFunc::ECFBlend_EaseIn>
+	{
+		static FORCEINLINE FECFVectorRegister Apply(const FECFVectorRegister& Alpha, const FECFVectorRegister& Exp)
+		{
+			return VectorPow(Alpha, Exp);
+		}
+	};
+
+	template<>
+	struct TBlend<EECFBlendFunc::ECFBlend_EaseOut>
+	{
+		static FORCEINLINE FECFVectorRegister Apply(const FECFVectorRegister& Alpha, const FECFVectorRegister& Exp)
+		{
+			return VectorPow(Alpha, VectorDivide(VectorOne(), Exp));
+		}
+	};
+
+	template<>
+	struct TBlend<EECFBlendFunc::ECFBlend_EaseInOut>
+	{
+		static FORCEINLINE FECFVectorRegister Apply(const FECFVectorRegister& Alpha, const FECFVectorRegister& Exp)
+		{
+			const FECFVectorRegister Half = VectorSetFloat1(0.5f);
+			const FECFVectorRegister Two = VectorSetFloat1(2.f);
+			const FECFVectorRegister EaseIn = VectorMultiply(VectorPow(VectorMultiply(Alpha, Two), Exp), Half);
+			const FECFVectorRegister EaseOut = VectorSubtract(VectorOne(), VectorMultiply(VectorPow(VectorSubtract(Two, VectorMultiply(Alpha, Two)), Exp), Half));
+			return VectorSelect(VectorCompareLT(Alpha, Half), EaseIn, EaseOut);
+		}
+	};
+
+	// Evaluates packed timelines. The blend function is known at compile time, so the loop has no branches.
+	template<EECFBlendFunc BlendFunc>
+	void EvaluateValues(int32 Count, const float* StartValues, const float* StopValues, const float* Times, const float* CurrentTimes, const float* BlendExps, float* OutAlphas, float* OutValues)
+	{
+		const FECFVectorRegister Zero = VectorZero();
+		const FECFVectorRegister One = VectorOne();
+
+		int32 Index = 0;
+		for (; Index + 4 <= Count; Index += 4)
+		{
+			const FECFVectorRegister Alpha = VectorMin(VectorMax(VectorDivide(VectorLoad(CurrentTimes + Index), VectorLoad(Times + Index)), Zero), One);
+			const FECFVectorRegister Start = VectorLoad(StartValues + Index);
+			const FECFVectorRegister Stop = VectorLoad(StopValues + Index);
+			const FECFVectorRegister Value = VectorMultiplyAdd(VectorSubtract(Stop, Start), TBlend<BlendFunc>::Apply(Alpha, VectorLoad(BlendExps + Index)), Start);
+
+			// When the timeline has ended use the exact stop value.
+			VectorStore(Alpha, OutAlphas + Index);
+			VectorStore(VectorSelect(VectorCompareGE(Alpha, One), Stop, Value), OutValues + Index);
+		}
+
+		for (; Index < Count; ++Index)
+		{
+			const float Alpha = FMath::Clamp(CurrentTimes[Index] / Times[Index], 0.f, 1.f);
+			OutAlphas[Index] = Alpha;
+			OutValues[Index] = (Alpha >= 1.f)
+				? StopValues[Index]
+				: FMath::Lerp(StartValues[Index], StopValues[Index], TECFBlendFunc<BlendFunc>::Apply(Alpha, BlendExps[Index]));
+		}
+	}
+}
+
+bool FECFTimelineBatch::IsEnabled()
+{
+	return GECFTimelineBatching;
+}
+
+bool FECFTimelineBatch::AddTimeline(UECFTimeline* Timeline)
+{
+	if (IsEnabled() == false)
+	{
+		return false;
+	}
+
+	const TECFTimelineCore<float>& MyTimeline = Timeline->MyTimeline;
+	FGroup& Group = Groups[static_cast<int32>(MyTimeline.BlendFunc)];
+	Timeline->Batch = this;
+	Timeline->BatchIndex = Group.Timelines.Add(Timeline);
+	Group.StartValues.Add(MyTimeline.StartValue);
+	Group.StopValues.Add(MyTimeline.StopValue);
+	Group.Times.Add(MyTimeline.Time);
+	Group.CurrentTimes.Add(MyTimeline.CurrentTime);
+	Group.BlendExps.Add(MyTimeline.BlendExp);
+	Group.Alphas.Add(0.f);
+	Group.Values.Add(MyTimeline.StartValue);
+	Group.Ticked.Add(false);
+	return true;
+}
+
+void FECFTimelineBatch::RemoveInvalidTimelines()
+{
+	for (FGroup& Group : Groups)
+	{
+		for (int32 Index = Group.Timelines.Num() - 1; Index >= 0; --Index)
+		{
+			UECFTimeline* Timeline = Group.Timelines[Index];
+			if (UECFSubsystem::IsActionValid(Timeline) == false)
+			{
+				Timeline->Batch = nullptr;
+				Timeline->BatchIndex = INDEX_NONE;
+				Group.RemoveAtSwap(Index);
+			}
+		}
+	}
+}
+
+void FECFTimelineBatch::Evaluate()
+{
+#if STATS
+	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("Timeline Batch - Evaluate"), STAT_ECFDETAILS_TIMELINEBATCH, STATGROUP_ECFDETAILS);
+#endif
+
+#if ECF_INSIGHT_PROFILING
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR("ECF-TimelineBatch-Evaluate");
+#endif
+
+	for (int32 GroupIndex = 0; GroupIndex < static_cast<int32>(UE_ARRAY_COUNT(Groups)); ++GroupIndex)
+	{
+		FGroup& Group = Groups[GroupIndex];
+		const int32 Count = Group.Timelines.Num();
+		if (Count == 0)
+		{
+			continue;
+		}
+
+		EvaluateValues(static_cast<EECFBlendFunc>(GroupIndex), Count, Group.StartValues.GetData(), Group.StopValues.GetData(), Group.Times.GetData(), Group.CurrentTimes.GetData(), Group.BlendExps.GetData(), Group.Alphas.GetData(), Group.Values.GetData());
+
+		// Callbacks might start new timelines which will be appended to this group,
+		// so iterate by index and only through the timelines evaluated above.
+		for (int32 Index = 0; Index < Count; ++Index)
+		{
+			if (Group.Ticked[Index])
+			{
+				Group.Ticked[Index] = false;
+				UECFTimeline* Timeline = Group.Timelines[Index];
+				if (Timeline->IsValid())
+				{
+					Timeline->TickBatched(Group.Values[Index], Group.Alphas[Index]);
+				}
+			}
+		}
+	}
+}
+
+void FECFTimelineBatch::QueueFlush(const TSharedPtr<FECFTimelineSinkFlush>& Flush)
+{
+	Flush->bIsQueued = true;
+	PendingFlushes.Add(Flush);
+}
+
+void FECFTimelineBatch::FlushSinks()
+{
+	if (PendingFlushes.Num() == 0)
+	{
+		return;
+	}
+
+#if STATS
+	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("Timeline Batch - Flush Sinks"), STAT_ECFDETAILS_TIMELINEBATCHFLUSH, STATGROUP_ECFDETAILS);
+#endif
+
+	// Flush functions might start new timelines, so launch them from a local copy.
+	TArray<TSharedPtr<FECFTimelineSinkFlush>> Flushes = MoveTemp(PendingFlushes);
+	PendingFlushes.Reset();
+	for (const TSharedPtr<FECFTimelineSinkFlush>& Flush : Flushes)
+	{
+		Flush->bIsQueued = false;
+		if (Flush->FlushFunc)
+		{
+			Flush->FlushFunc();
+		}
+	}
+}
+
+void FECFTimelineBatch::Reset()
+{
+	for (FGroup& Group : Groups)
+	{
+		Group.Reset();
+	}
+
+	for (const TSharedPtr<FECFTimelineSinkFlush>& Flush : PendingFlushes)
+	{
+		Flush->bIsQueued = false;
+	}
+	PendingFlushes.Reset();
+}
+
+int32 FECFTimelineBatch::Num() const
+{
+	int32 Result = 0;
+	for (const FGroup& Group : Groups)
+	{
+		Result += Group.Timelines.Num();
+	}
+	return Result;
+}
+
+void FECFTimelineBatch::EvaluateValues(EECFBlendFunc BlendFunc, int32 Count, const float* StartValues, const float* StopValues, const float* Times, const float* CurrentTimes, const float* BlendExps, float* OutAlphas, float* OutValues)
+{
+	switch (BlendFunc)
+	{
+	case EECFBlendFunc::ECFBlend_Linear:
+		ECFTimelineBatch::EvaluateValues<EECFBlendFunc::ECFBlend_Linear>(Count, StartValues, StopValues, Times, CurrentTimes, BlendExps, OutAlphas, OutValues);
+		break;
+	case EECFBlendFunc::ECFBlend_Cubic:
+		ECFTimelineBatch::EvaluateValues<EECFBlendFunc::ECFBlend_Cubic>(Count, StartValues, StopValues, Times, CurrentTimes, BlendExps, OutAlphas, OutValues);
+		break;
+	case EECFBlendFunc::ECFBlend_EaseIn:
+		ECFTimelineBatch::EvaluateValues<EECFBlendFunc::ECFBlend_EaseIn>(Count, StartValues, StopValues, Times, CurrentTimes, BlendExps, OutAlphas, OutValues);
+		break;
+	case EECFBlendFunc::ECFBlend_EaseOut:
+		ECFTimelineBatch::EvaluateValues<EECFBlendFunc::ECFBlend_EaseOut>(Count, StartValues, StopValues, Times, CurrentTimes, BlendExps, OutAlphas, OutValues);
+		break;
+	case EECFBlendFunc::ECFBlend_EaseInOut:
+		ECFTimelineBatch::EvaluateValues<EECFBlendFunc::ECFBlend_EaseInOut>(Count, StartValues, StopValues, Times, CurrentTimes, BlendExps, OutAlphas, OutValues);
+		break;
+	}
+}
+
+void FECFTimelineBatch::FGroup::RemoveAtSwap(int32 Index)
+{
+	Timelines.RemoveAtSwap(Index);
+	StartValues.RemoveAtSwap(Index);
+	StopValues.RemoveAtSwap(Index);
+	Times.RemoveAtSwap(Index);
+	CurrentTimes.RemoveAtSwap(Index);
+	BlendExps.RemoveAtSwap(Index);
+	Alphas.RemoveAtSwap(Index);
+	Values.RemoveAtSwap(Index);
+	Ticked.RemoveAtSwap(Index);
+
+	// The last timeline has been moved to the removed one's place.
+	if (Timelines.IsValidIndex(Index))
+	{
+		Timelines[Index]->BatchIndex = Index;
+	}
+}
+
+void FECFTimelineBatch::FGroup::Reset()
+{
+	Timelines.Reset();
+	StartValues.Reset();
+	StopValues.Reset();
+	Times.Reset();
+	CurrentTimes.Reset();
+	BlendExps.Reset();
+	Alphas.Reset();
+	Values.Reset();
+	Ticked.Reset();
+}
+
+/*^^^ Benchmark ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^*/
+
+#if !UE_BUILD_SHIPPING
+
+static FAutoConsoleCommand CmdECFBenchmarkTimelines(
+	TEXT("ECF.Benchmark.Timelines"),
+	TEXT("Compares the per-object and the batched timeline paths. Usage: ECF.Benchmark.Timelines [TimelinesCount=10000] [FramesCount=100]"),
+	FConsoleCommandWithArgsDelegate::CreateStatic(&FECFTimelineBatch::RunBenchmark));
+
+void FECFTimelineBatch::RunBenchmark(const TArray<FString>& Args)
+{
+	const int32 TimelinesCount = (Args.Num() > 0) ? FCString::Atoi(*Args[0]) : 10000;
+	const int32 FramesCount = (Args.Num() > 1) ? FCString::Atoi(*Args[1]) : 100;
+
+	if (TimelinesCount <= 0 || FramesCount <= 0)
+	{
+		UE_LOG(LogECFTimelineBatch, Warning, TEXT("ECF - Timelines benchmark can't be launched. It requires positive arguments."));
+		return;
+	}
+
+	// Both paths are driven directly, without the subsystem, so running actions are not affected and don't add to the measurement.
+	const float DeltaTime = 1.f / 60.f;
+	const int32 BlendFuncsNum = static_cast<int32>(UE_ARRAY_COUNT(Groups));
+	double FrameTimes[2] = { 0.0, 0.0 };
+	float Checksum = 0.f;
+
+	TArray<TUniqueFunction<void(float, float)>> TickFuncs;
+	TickFuncs.Reserve(TimelinesCount);
+	for (int32 TimelineIndex = 0; TimelineIndex < TimelinesCount; ++TimelineIndex)
+	{
+		TickFuncs.Add([&Checksum](float Value, float Time)
+		{
+			Checksum += Value;
+		});
+	}
+
+	// Per-object path: every timeline evaluates it's own value.
+	{
+		TArray<TECFTimelineCore<float>> Timelines;
+		Timelines.SetNum(TimelinesCount);
+		for (int32 TimelineIndex = 0; TimelineIndex < TimelinesCount; ++TimelineIndex)
+		{
+			Timelines[TimelineIndex].Setup(0.f, 1.f, 1000.f, static_cast<EECFBlendFunc>(TimelineIndex % BlendFuncsNum), 2.f);
+		}
+
+		const double StartTime = FPlatformTime::Seconds();
+		for (int32 Frame = 0; Frame < FramesCount; ++Frame)
+		{
+			for (int32 TimelineIndex = 0; TimelineIndex < TimelinesCount; ++TimelineIndex)
+			{
+				TECFTimelineCore<float>& Timeline = Timelines[TimelineIndex];
+				Timeline.Tick(DeltaTime);
+				TickFuncs[TimelineIndex](Timeline.CurrentValue, Timeline.CurrentTime);
+			}
+		}
+		FrameTimes[0] = (FPlatformTime::Seconds() - StartTime) * 1000.0 / FramesCount;
+	}
+
+	// Batched path: timelines only advance their time and values are evaluated by groups of blend functions.
+	{
+		FECFTimelineBatch BenchmarkBatch;
+		TArray<int32> TickFuncIndices[UE_ARRAY_COUNT(Groups)];
+		for (int32 TimelineIndex = 0; TimelineIndex < TimelinesCount; ++TimelineIndex)
+		{
+			const int32 GroupIndex = TimelineIndex % BlendFuncsNum;
+			FGroup& Group = BenchmarkBatch.Groups[GroupIndex];
+			Group.StartValues.Add(0.f);
+			Group.StopValues.Add(1.f);
+			Group.Times.Add(1000.f);
+			Group.CurrentTimes.Add(0.f);
+			Group.BlendExps.Add(2.f);
+			Group.Alphas.Add(0.f);
+			Group.Values.Add(0.f);
+			TickFuncIndices[GroupIndex].Add(TimelineIndex);
+		}
+
+		const double StartTime = FPlatformTime::Seconds();
+		for (int32 Frame = 0; Frame < FramesCount; ++Frame)
+		{
+			for (int32 GroupIndex = 0; GroupIndex < BlendFuncsNum; ++GroupIndex)
+			{
+				FGroup& Group = BenchmarkBatch.Groups[GroupIndex];
+				const int32 Count = Group.CurrentTimes.Num();
+				for (int32 Index = 0; Index < Count; ++Index)
+				{
+					Group.CurrentTimes[Index] = FMath::Clamp(Group.CurrentTimes[Index] + DeltaTime, 0.f, Group.Times[Index]);
+				}
+
+				EvaluateValues(static_cast<EECFBlendFunc>(GroupIndex), Count, Group.StartValues.GetData(), Group.StopValues.GetData(), Group.Times.GetData(), Group.CurrentTimes.GetData(), Group.BlendExps.GetData(), Group.Alphas.GetData(), Group.Values.GetData());
+
+				for (int32 Index = 0; Index < Count; ++Index)
+				{
+					TickFuncs[TickFuncIndices[GroupIndex][Index]](Group.Values[Index], Group.CurrentTimes[Index]);
+				}
+			}
+		}
+		FrameTimes[1] = (FPlatformTime::Seconds() - StartTime) * 1000.0 / FramesCount;
+	}
+
+	UE_LOG(LogECFTimelineBatch, Log, TEXT("ECF - Timelines benchmark (%d timelines, %d frames): per-object %.3f ms/frame, batched %.3f ms/frame (checksum %f)."),
+		TimelinesCount, FramesCount, FrameTimes[0], FrameTimes[1], Checksum);
+}
+
+#endif
+
+ECF_PRAGMA_ENABLE_OPTIMIZATION
@@ -0,0 +1,56 @@
+// Copyright (c) 2024 Damian Nowakowski. All rights reserved.
+
+#include "ECFTimelineSink.h"
+#include "UObject/UnrealType.h"
+
+ECF_PRAGMA_DISABLE_OPTIMIZATION
+
+FECFTimelineSink FECFTimelineSink::Memory(float* InTarget, const TSharedPtr<FECFTimelineSinkFlush>& InFlush/* = nullptr*/)
+{
+	FECFTimelineSink Sink;
+	Sink.MemoryTarget = InTarget;
+	Sink.Flush = InFlush;
+	return Sink;
+}
+
+FECFTimelineSink FECFTimelineSink::Property(UObject* InObject, FName InPropertyName, const TSharedPtr<FECFTimelineSinkFlush>& InFlush/* = nullptr*/)
+{
+	FECFTimelineSink Sink;
+	Sink.Flush = InFlush;
+
+	if (InObject)
+	{
+		FProperty* FoundProperty = FindFProperty<FProperty>(InObject->GetClass(), InPropertyName);
+		Sink.FloatProperty = CastField<FFloatProperty>(FoundProperty);
+		Sink.DoubleProperty = CastField<FDoubleProperty>(FoundProperty);
+		if (Sink.FloatProperty || Sink.DoubleProperty)
+		{
+			Sink.PropertyObject = InObject;
+		}
+		else
+		{
+			ensureMsgf(false, TEXT("ECF - Timeline sink can't find float property %s in %s."), *InPropertyName.ToString(), *InObject->GetName());
+		}
+	}
+
+	return Sink;
+}
+
+TSharedPtr<FECFTimelineSinkFlush> FECFTimelineSink::MakeFlush(TUniqueFunction<void()>&& InFlushFunc)
+{
+	return MakeShared<FECFTimelineSinkFlush>(MoveTemp(InFlushFunc));
+}
+
+void FECFTimelineSink::WriteProperty(UObject* Object, float Value)
+{
+	if (FloatProperty)
+	{
+		FloatProperty->SetPropertyValue_InContainer(Object, Value);
+	}
+	else
+	{
+		DoubleProperty->SetPropertyValue_InContainer(Object, Value);
+	}
+}
+
+ECF_PRAGMA_ENABLE_OPTIMIZATION
@@ -13,6 +13,7 @@
 #include "CodeFlowActions/ECFTimeline.h"
 #include "CodeFlowActions/ECFTimelineVector.h"
 #include "CodeFlowActions/ECFTimelineLinearColor.h"
+#include "CodeFlowActions/ECFTypedTimeline.h"
 #include "CodeFlowActions/ECFCustomTimeline.h"
 #include "CodeFlowActions/ECFCustomTimelineVector.h"
 #include "CodeFlowActions/ECFCustomTimelineLinearColor.h"
@@ -21,11 +22,16 @@
 #include "CodeFlowActions/ECFDoNTimes.h"
 #include "CodeFlowActions/ECFDoNoMoreThanXTime.h"
 #include "CodeFlowActions/ECFRunAsyncThen.h"
+#include "CodeFlowActions/ECFRunAsyncGraph.h"
 
 #include "CodeFlowActions/Coroutines/ECFWaitSeconds.h"
 #include "CodeFlowActions/Coroutines/ECFWaitTicks.h"
 #include "CodeFlowActions/Coroutines/ECFWaitUntil.h"
 #include "CodeFlowActions/Coroutines/ECFRunAsyncAndWait.h"
+#include "CodeFlowActions/Coroutines/ECFWhenAllAny.h"
+#include "CodeFlowActions/Coroutines/ECFWaitForDelegate.h"
+
+#include "Async/ParallelFor.h"
 
 ECF_PRAGMA_DISABLE_OPTIMIZATION
 
@@ -313,6 +319,22 @@ FECFHandle FFlow::AddTimeline(const UObject* InOwner, float InStartValue, float
 		return FECFHandle();
 }
 
+FECFHandle FFlow::AddTimelineSink(const UObject* InOwner, float InStartValue, float InStopValue, float InTime, const FECFTimelineSink& InSink, TUniqueFunction<void(float/* Value*/, float/* Time*/, bool/* bStopped*/)>&& InCallbackFunc/* = nullptr*/, EECFBlendFunc InBlendFunc/* = EECFBlendFunc::ECFBlend_Linear*/, float InBlendExp/* = 1.f*/, const FECFActionSettings& Settings/* = {}*/)
+{
+	if (UECFSubsystem* ECF = UECFSubsystem::Get(InOwner))
+		return ECF->AddAction<UECFTimeline>(InOwner, Settings, FECFInstanceId(), InStartValue, InStopValue, InTime, FECFTimelineSink(InSink), MoveTemp(InCallbackFunc), InBlendFunc, InBlendExp);
+	else
+		return FECFHandle();
+}
+
+FECFHandle FFlow::AddTimelineSink(const UObject* InOwner, float InStartValue, float InStopValue, float InTime, const FECFTimelineSink& InSink, TUniqueFunction<void(float/* Value*/, float/* Time*/)>&& InCallbackFunc, EECFBlendFunc InBlendFunc/* = EECFBlendFunc::ECFBlend_Linear*/, float InBlendExp/* = 1.f*/, const FECFActionSettings& Settings/* = {}*/)
+{
+	if (UECFSubsystem* ECF = UECFSubsystem::Get(InOwner))
+		return ECF->AddAction<UECFTimeline>(InOwner, Settings, FECFInstanceId(), InStartValue, InStopValue, InTime, FECFTimelineSink(InSink), MoveTemp(InCallbackFunc), InBlendFunc, InBlendExp);
+	else
+		return FECFHandle();
+}
+
 void FFlow::RemoveAllTimelines(const UObject* WorldContextObject, bool bComplete/* = false*/, UObject* InOwner/* = nullptr*/)
 {
 	if (UECFSubsystem* ECF = UECFSubsystem::Get(WorldContextObject))
@@ -367,6 +389,22 @@ void FFlow::RemoveAllTimelinesLinearColor(const UObject* WorldContextObject, boo
 		ECF->RemoveActionsOfClass<UECFTimelineLinearColor>(bComplete, InOwner);
 }
 
+/*^^^ Typed Timeline ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^*/
+
+FECFHandle FFlow::StartTypedTimeline(const UObject* InOwner, TUniquePtr<FECFTypedTimelineBase>&& InTimeline, const FECFActionSettings& Settings)
+{
+	if (UECFSubsystem* ECF = UECFSubsystem::Get(InOwner))
+		return ECF->AddAction<UECFTypedTimeline>(InOwner, Settings, FECFInstanceId(), MoveTemp(InTimeline));
+	else
+		return FECFHandle();
+}
+
+void FFlow::RemoveAllTypedTimelines(const UObject* WorldContextObject, bool bComplete/* = false*/, UObject* InOwner/* = nullptr*/)
+{
+	if (UECFSubsystem* ECF = UECFSubsystem::Get(WorldContextObject))
+		ECF->RemoveActionsOfClass<UECFTypedTimeline>(bComplete, InOwner);
+}
+
 /*^^^ Custom Timeline ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^*/
 
 FECFHandle FFlow::AddCustomTimeline(const UObject* InOwner, UCurveFloat* CurveFloat, TUniqueFunction<void(float/* Value*/, float/* Time*/)>&& InTickFunc, TUniqueFunction<void(float/* Value*/, float/* Time*/, bool/* bStopped*/)>&& InCallbackFunc/* = nullptr*/, const FECFActionSettings& Settings/* = {}*/)
@@ -505,26 +543,41 @@ void FEnhancedCodeFlow::RemoveAllDoNoMoreThanXTimes(const UObject* WorldContextO
 
 /*^^^ Run Async Then ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^*/
 
-FECFHandle FEnhancedCodeFlow::RunAsyncThen(const UObject* InOwner, TUniqueFunction<void()>&& InAsyncTaskFunc, TUniqueFunction<void(bool/* bTimedOut*/, bool/* bStopped*/)>&& InCallbackFunc, float InTimeOut, EECFAsyncPrio InThreadPriority, const FECFActionSettings& Settings)
+FECFHandle FEnhancedCodeFlow::RunAsyncThen(const UObject* InOwner, TUniqueFunction<void()>&& InAsyncTaskFunc, TUniqueFunction<void(bool/* bTimedOut*/, bool/* bStopped*/)>&& InCallbackFunc, float InTimeOut, const FECFAsyncExecutor& InExecutor, const FECFActionSettings& Settings)
+{
+	return RunAsyncThen(InOwner, FECFCancellationToken::AdaptTaskFunc(MoveTemp(InAsyncTaskFunc)), MoveTemp(InCallbackFunc), InTimeOut, InExecutor, Settings);
+}
+
+FECFHandle FEnhancedCodeFlow::RunAsyncThen(const UObject* InOwner, TUniqueFunction<void()>&& InAsyncTaskFunc, TUniqueFunction<void(bool/* bTimedOut*/)>&& InCallbackFunc, float InTimeOut, const FECFAsyncExecutor& InExecutor, const FECFActionSettings& Settings)
+{
+	return RunAsyncThen(InOwner, FECFCancellationToken::AdaptTaskFunc(MoveTemp(InAsyncTaskFunc)), MoveTemp(InCallbackFunc), InTimeOut, InExecutor, Settings);
+}
+
+FECFHandle FEnhancedCodeFlow::RunAsyncThen(const UObject* InOwner, TUniqueFunction<void()>&& InAsyncTaskFunc, TUniqueFunction<void()>&& InCallbackFunc, float InTimeOut, const FECFAsyncExecutor& InExecutor, const FECFActionSettings& Settings)
+{
+	return RunAsyncThen(InOwner, FECFCancellationToken::AdaptTaskFunc(MoveTemp(InAsyncTaskFunc)), MoveTemp(InCallbackFunc), InTimeOut, InExecutor, Settings);
+}
+
+FECFHandle FEnhancedCodeFlow::RunAsyncThen(const UObject* InOwner, TUniqueFunction<void(const FECFCancellationToken&/* Token*/)>&& InAsyncTaskFunc, TUniqueFunction<void(bool/* bTimedOut*/, bool/* bStopped*/)>&& InCallbackFunc, float InTimeOut, const FECFAsyncExecutor& InExecutor, const FECFActionSettings& Settings)
 {
 	if (UECFSubsystem* ECF = UECFSubsystem::Get(InOwner))
-		return ECF->AddAction<UECFRunAsyncThen>(InOwner, Settings, FECFInstanceId(), MoveTemp(InAsyncTaskFunc), MoveTemp(InCallbackFunc), InTimeOut, InThreadPriority);
+		return ECF->AddAction<UECFRunAsyncThen>(InOwner, Settings, FECFInstanceId(), MoveTemp(InAsyncTaskFunc), MoveTemp(InCallbackFunc), InTimeOut, InExecutor);
 	else
 		return FECFHandle();
 }
 
-FECFHandle FEnhancedCodeFlow::RunAsyncThen(const UObject* InOwner, TUniqueFunction<void()>&& InAsyncTaskFunc, TUniqueFunction<void(bool/* bTimedOut*/)>&& InCallbackFunc, float InTimeOut, EECFAsyncPrio InThreadPriority, const FECFActionSettings& Settings)
+FECFHandle FEnhancedCodeFlow::RunAsyncThen(const UObject* InOwner, TUniqueFunction<void(const FECFCancellationToken&/* Token*/)>&& InAsyncTaskFunc, TUniqueFunction<void(bool/* bTimedOut*/)>&& InCallbackFunc, float InTimeOut, const FECFAsyncExecutor& InExecutor, const FECFActionSettings& Settings)
 {
 	if (UECFSubsystem* ECF = UECFSubsystem::Get(InOwner))
-		return ECF->AddAction<UECFRunAsyncThen>(InOwner, Settings, FECFInstanceId(), MoveTemp(InAsyncTaskFunc), MoveTemp(InCallbackFunc), InTimeOut, InThreadPriority);
+		return ECF->AddAction<UECFRunAsyncThen>(InOwner, Settings, FECFInstanceId(), MoveTemp(InAsyncTaskFunc), MoveTemp(InCallbackFunc), InTimeOut, InExecutor);
 	else
 		return FECFHandle();
 }
 
-FECFHandle FEnhancedCodeFlow::RunAsyncThen(const UObject* InOwner, TUniqueFunction<void()>&& InAsyncTaskFunc, TUniqueFunction<void()>&& InCallbackFunc, float InTimeOut, EECFAsyncPrio InThreadPriority, const FECFActionSettings& Settings)
+FECFHandle FEnhancedCodeFlow::RunAsyncThen(const UObject* InOwner, TUniqueFunction<void(const FECFCancellationToken&/* Token*/)>&& InAsyncTaskFunc, TUniqueFunction<void()>&& InCallbackFunc, float InTimeOut, const FECFAsyncExecutor& InExecutor, const FECFActionSettings& Settings)
 {
 	if (UECFSubsystem* ECF = UECFSubsystem::Get(InOwner))
-		return ECF->AddAction<UECFRunAsyncThen>(InOwner, Settings, FECFInstanceId(), MoveTemp(InAsyncTaskFunc), MoveTemp(InCallbackFunc), InTimeOut, InThreadPriority);
+		return ECF->AddAction<UECFRunAsyncThen>(InOwner, Settings, FECFInstanceId(), MoveTemp(InAsyncTaskFunc), MoveTemp(InCallbackFunc), InTimeOut, InExecutor);
 	else
 		return FECFHandle();
 }
@@ -535,6 +588,127 @@ void FEnhancedCodeFlow::RemoveAllRunAsyncThen(const UObject* WorldContextObject,
 		ECF->RemoveActionsOfClass<UECFRunAsyncThen>(false, InOwner);
 }
 
+/*^^^ Run Async Batch ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^*/
+
+FECFHandle FEnhancedCodeFlow::RunAsyncBatch(const UObject* InOwner, int32 InCount, TUniqueFunction<void(int32/* Index*/)>&& InBatchFunc, TUniqueFunction<void(bool/* bTimedOut*/, bool/* bStopped*/)>&& InCallbackFunc, float InTimeOut, int32 InChunkSize, const FECFAsyncExecutor& InExecutor, const FECFActionSettings& Settings)
+{
+	if (IsBatchValid(InCount, InBatchFunc))
+		return RunAsyncThen(InOwner, MakeBatchTask(InCount, MoveTemp(InBatchFunc), InChunkSize), MoveTemp(InCallbackFunc), InTimeOut, InExecutor, Settings);
+	else
+		return FECFHandle();
+}
+
+FECFHandle FEnhancedCodeFlow::RunAsyncBatch(const UObject* InOwner, int32 InCount, TUniqueFunction<void(int32/* Index*/)>&& InBatchFunc, TUniqueFunction<void(bool/* bTimedOut*/)>&& InCallbackFunc, float InTimeOut, int32 InChunkSize, const FECFAsyncExecutor& InExecutor, const FECFActionSettings& Settings)
+{
+	if (IsBatchValid(InCount, InBatchFunc))
+		return RunAsyncThen(InOwner, MakeBatchTask(InCount, MoveTemp(InBatchFunc), InChunkSize), MoveTemp(InCallbackFunc), InTimeOut, InExecutor, Settings);
+	else
+		return FECFHandle();
+}
+
+FECFHandle FEnhancedCodeFlow::RunAsyncBatch(const UObject* InOwner, int32 InCount, TUniqueFunction<void(int32/* Index*/)>&& InBatchFunc, TUniqueFunction<void()>&& InCallbackFunc, float InTimeOut, int32 InChunkSize, const FECFAsyncExecutor& InExecutor, const FECFActionSettings& Settings)
+{
+	if (IsBatchValid(InCount, InBatchFunc))
+		return RunAsyncThen(InOwner, MakeBatchTask(InCount, MoveTemp(InBatchFunc), InChunkSize), MoveTemp(InCallbackFunc), InTimeOut, InExecutor, Settings);
+	else
+		return FECFHandle();
+}
+
+bool FEnhancedCodeFlow::IsBatchValid(int32 InCount, const TUniqueFunction<void(int32)>& InBatchFunc)
+{
+	if ((InCount <= 0) || !InBatchFunc)
+	{
+		ensureMsgf(false, TEXT("ECF - Run Async Batch failed to start. Are you sure the Count is greater than 0 and the Batch Function is set properly?"));
+		return false;
+	}
+	return true;
+}
+
+TUniqueFunction<void(const FECFCancellationToken&)> FEnhancedCodeFlow::MakeBatchTask(int32 InCount, TUniqueFunction<void(int32)>&& InBatchFunc, int32 InChunkSize)
+{
+	// By default give every worker a few chunks, so faster workers can take over the work of slower ones.
+	const int32 ChunkSize = InChunkSize > 0 ? InChunkSize : FMath::Max(1, InCount / (FMath::Max(1, FTaskGraphInterface::Get().GetNumWorkerThreads()) * 4));
+	const int32 ChunksNum = FMath::DivideAndRoundUp(InCount, ChunkSize);
+
+	return [InCount, ChunkSize, ChunksNum, BatchFunc = MoveTemp(InBatchFunc)](const FECFCancellationToken& Token)
+	{
+		ParallelFor(ChunksNum, [&](int32 ChunkId)
+		{
+			const int32 ChunkEnd = FMath::Min(InCount, (ChunkId + 1) * ChunkSize);
+			for (int32 Index = ChunkId * ChunkSize; Index < ChunkEnd; Index++)
+			{
+				if (Token.IsCancelled())
+				{
+					return;
+				}
+				BatchFunc(Index);
+			}
+		});
+	};
+}
+
+/*^^^ Run Async Graph ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^*/
+
+FECFHandle FEnhancedCodeFlow::RunAsyncGraph(const UObject* InOwner, FECFAsyncGraph&& InGraph, TUniqueFunction<void(bool/* bTimedOut*/, bool/* bStopped*/)>&& InCallbackFunc, float InTimeOut, const FECFActionSettings& Settings)
+{
+	if (UECFSubsystem* ECF = UECFSubsystem::Get(InOwner))
+		return ECF->AddAction<UECFRunAsyncGraph>(InOwner, Settings, FECFInstanceId(), MoveTemp(InGraph), MoveTemp(InCallbackFunc), InTimeOut);
+	else
+		return FECFHandle();
+}
+
+FECFHandle FEnhancedCodeFlow::RunAsyncGraph(const UObject* InOwner, FECFAsyncGraph&& InGraph, TUniqueFunction<void(bool/* bTimedOut*/)>&& InCallbackFunc, float InTimeOut, const FECFActionSettings& Settings)
+{
+	if (UECFSubsystem* ECF = UECFSubsystem::Get(InOwner))
+		return ECF->AddAction<UECFRunAsyncGraph>(InOwner, Settings, FECFInstanceId(), MoveTemp(InGraph), MoveTemp(InCallbackFunc), InTimeOut);
+	else
+		return FECFHandle();
+}
+
+FECFHandle FEnhancedCodeFlow::RunAsyncGraph(const UObject* InOwner, FECFAsyncGraph&& InGraph, TUniqueFunction<void()>&& InCallbackFunc, float InTimeOut, const FECFActionSettings& Settings)
+{
+	if (UECFSubsystem* ECF = UECFSubsystem::Get(InOwner))
+		return ECF->AddAction<UECFRunAsyncGraph>(InOwner, Settings, FECFInstanceId(), MoveTemp(InGraph), MoveTemp(InCallbackFunc), InTimeOut);
+	else
+		return FECFHandle();
+}
+
+void FEnhancedCodeFlow::RemoveAllRunAsyncGraphs(const UObject* WorldContextObject, UObject* InOwner)
+{
+	if (UECFSubsystem* ECF = UECFSubsystem::Get(WorldContextObject))
+		ECF->RemoveActionsOfClass<UECFRunAsyncGraph>(false, InOwner);
+}
+
+/*^^^ Coroutines Control ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^*/
+
+FECFHandle FEnhancedCodeFlow::StartCoroutine(const UObject* InOwner, TUniqueFunction<FECFCoroutine()>&& InCoroutineFunc)
+{
+	if (UECFSubsystem* ECF = UECFSubsystem::Get(InOwner))
+		return ECF->StartCoroutine(InOwner, MoveTemp(InCoroutineFunc));
+	else
+		return FECFHandle();
+}
+
+bool FEnhancedCodeFlow::IsCoroutineRunning(const UObject* WorldContextObject, const FECFHandle& Handle)
+{
+	if (UECFSubsystem* ECF = UECFSubsystem::Get(WorldContextObject))
+		return ECF->HasCoroutine(Handle);
+	else
+		return false;
+}
+
+void FEnhancedCodeFlow::StopCoroutine(const UObject* WorldContextObject, FECFHandle& Handle)
+{
+	if (UECFSubsystem* ECF = UECFSubsystem::Get(WorldContextObject))
+		ECF->StopCoroutine(Handle);
+}
+
+void FEnhancedCodeFlow::StopAllCoroutines(const UObject* WorldContextObject, UObject* InOwner)
+{
+	if (UECFSubsystem* ECF = UECFSubsystem::Get(WorldContextObject))
+		ECF->StopCoroutines(InOwner);
+}
+
 /*^^^ Wait Seconds (Coroutine) ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^*/
 
 FECFCoroutineAwaiter_WaitSeconds FEnhancedCodeFlow::WaitSeconds(const UObject* InOwner, float InTime, const FECFActionSettings& Settings /*= {}*/)
@@ -545,7 +719,10 @@ FECFCoroutineAwaiter_WaitSeconds FEnhancedCodeFlow::WaitSeconds(const UObject* I
 void FEnhancedCodeFlow::RemoveAllWaitSeconds(const UObject* WorldContextObject, bool bComplete, UObject* InOwner)
 {
 	if (UECFSubsystem* ECF = UECFSubsystem::Get(WorldContextObject))
+	{
 		ECF->RemoveActionsOfClass<UECFWaitSeconds>(bComplete, InOwner);
+		ECF->CoroutineScheduler.RemoveTimers(EECFCoroutineTimerType::Seconds, bComplete, InOwner);
+	}
 }
 
 /*^^^ Wait Ticks (Coroutine) ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^*/
@@ -558,7 +735,43 @@ FECFCoroutineAwaiter_WaitTicks FEnhancedCodeFlow::WaitTicks(const UObject* InOwn
 void FEnhancedCodeFlow::RemoveAllWaitTicks(const UObject* WorldContextObject, bool bComplete, UObject* InOwner)
 {
 	if (UECFSubsystem* ECF = UECFSubsystem::Get(WorldContextObject))
+	{
 		ECF->RemoveActionsOfClass<UECFWaitTicks>(bComplete, InOwner);
+		ECF->CoroutineScheduler.RemoveTimers(EECFCoroutineTimerType::Ticks, bComplete, InOwner);
+	}
+}
+
+/*^^^ Yield And Time Slicing (Coroutine) ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^*/
+
+FECFCoroutineAwaiter_Yield FEnhancedCodeFlow::YieldCoroutine(const UObject* InOwner)
+{
+	return FECFCoroutineAwaiter_Yield(InOwner);
+}
+
+TECFTask<> FEnhancedCodeFlow::TimeSlicedFor(const UObject* InOwner, int32 InCount, float InBudgetMs, TUniqueFunction<void(int32/* Index*/)> InBody)
+{
+#ifdef __cpp_impl_coroutine
+	FECFTimeSlice Slice(InBudgetMs);
+	for (int32 Index = 0; Index < InCount; Index++)
+	{
+		InBody(Index);
+		if ((Index + 1 < InCount) && Slice.ShouldYield())
+		{
+			co_yield YieldCoroutine(InOwner);
+		}
+	}
+#else
+	for (int32 Index = 0; Index < InCount; Index++)
+	{
+		InBody(Index);
+	}
+#endif
+}
+
+void FEnhancedCodeFlow::RemoveAllYields(const UObject* WorldContextObject, bool bComplete, UObject* InOwner)
+{
+	if (UECFSubsystem* ECF = UECFSubsystem::Get(WorldContextObject))
+		ECF->CoroutineScheduler.RemoveTimers(EECFCoroutineTimerType::Yield, bComplete, InOwner);
 }
 
 /*^^^ Wait Until (Coroutine) ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^*/
@@ -576,9 +789,14 @@ void FEnhancedCodeFlow::RemoveAllWaitUntil(const UObject* WorldContextObject, bo
 
 /*^^^ Run Async And Wait (Coroutine) ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^*/
 
-FECFCoroutineAwaiter_RunAsyncAndWait FEnhancedCodeFlow::RunAsyncAndWait(const UObject* InOwner, TUniqueFunction<void()>&& InAsyncTaskFunc, float InTimeOut, EECFAsyncPrio InThreadPriority, const FECFActionSettings& Settings)
+FECFCoroutineAwaiter_RunAsyncAndWait FEnhancedCodeFlow::RunAsyncAndWait(const UObject* InOwner, TUniqueFunction<void()>&& InAsyncTaskFunc, float InTimeOut, const FECFAsyncExecutor& InExecutor, const FECFActionSettings& Settings)
+{
+	return FECFCoroutineAwaiter_RunAsyncAndWait(InOwner, Settings, FECFCancellationToken::AdaptTaskFunc(MoveTemp(InAsyncTaskFunc)), InTimeOut, InExecutor);
+}
+
+FECFCoroutineAwaiter_RunAsyncAndWait FEnhancedCodeFlow::RunAsyncAndWait(const UObject* InOwner, TUniqueFunction<void(const FECFCancellationToken&/* Token*/)>&& InAsyncTaskFunc, float InTimeOut, const FECFAsyncExecutor& InExecutor, const FECFActionSettings& Settings)
 {
-	return FECFCoroutineAwaiter_RunAsyncAndWait(InOwner, Settings, MoveTemp(InAsyncTaskFunc), InTimeOut, InThreadPriority);
+	return FECFCoroutineAwaiter_RunAsyncAndWait(InOwner, Settings, MoveTemp(InAsyncTaskFunc), InTimeOut, InExecutor);
 }
 
 void FEnhancedCodeFlow::RemoveAllRunAsyncAndWait(const UObject* WorldContextObject, bool bComplete, UObject* InOwner)
@@ -587,4 +805,32 @@ void FEnhancedCodeFlow::RemoveAllRunAsyncAndWait(const UObject* WorldContextObje
 		ECF->RemoveActionsOfClass<UECFRunAsyncAndWait>(bComplete, InOwner);
 }
 
+/*^^^ Resume On Background / Game Thread (Coroutine) ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^*/
+
+FECFCoroutineAwaiter_ResumeOnBackground FEnhancedCodeFlow::ResumeOnBackground(const UObject* InOwner, const FECFAsyncExecutor& InExecutor)
+{
+	return FECFCoroutineAwaiter_ResumeOnBackground(InOwner, InExecutor);
+}
+
+FECFCoroutineAwaiter_ResumeOnGameThread FEnhancedCodeFlow::ResumeOnGameThread()
+{
+	return FECFCoroutineAwaiter_ResumeOnGameThread();
+}
+
+/*^^^ Wait For Delegate (Coroutine) ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^*/
+
+void FEnhancedCodeFlow::RemoveAllWaitForDelegate(const UObject* WorldContextObject, bool bComplete, UObject* InOwner)
+{
+	if (UECFSubsystem* ECF = UECFSubsystem::Get(WorldContextObject))
+		ECF->RemoveActionsOfClass<UECFWaitForDelegate>(bComplete, InOwner);
+}
+
+/*^^^ When All / When Any (Coroutine) ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^*/
+
+void FEnhancedCodeFlow::RemoveAllWhenAllAny(const UObject* WorldContextObject, bool bComplete, UObject* InOwner)
+{
+	if (UECFSubsystem* ECF = UECFSubsystem::Get(WorldContextObject))
+		ECF->RemoveActionsOfClass<UECFWhenAllAny>(bComplete, InOwner);
+}
+
 ECF_PRAGMA_ENABLE_OPTIMIZATION
@@ -1,8 +1,14 @@
 // Copyright (c) 2024 Damian Nowakowski. All rights reserved.
 
 #include "Modules/ModuleManager.h"
+#include "Coroutines/ECFCoroutineAllocator.h"
 
 class ENHANCEDCODEFLOW_API FEnhancedCodeFlowModule : public IModuleInterface
-{};
+{
+	void ShutdownModule() override
+	{
+		FECFCoroutineAllocator::ReleaseUnusedMemory();
+	}
+};
 
 IMPLEMENT_MODULE(FEnhancedCodeFlowModule, EnhancedCodeFlow)
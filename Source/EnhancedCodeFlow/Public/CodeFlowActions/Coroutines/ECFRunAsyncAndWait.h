@@ -3,8 +3,10 @@
 #pragma once
 
 #include "Coroutines/ECFCoroutineActionBase.h"
-#include "Templates/Atomic.h"
 #include "Async/Async.h"
+#include "ECFSubsystem.h"
+#include "ECFCancellationToken.h"
+#include "ECFAsyncExecutor.h"
 #include "ECFTypes.h"
 #include "Async/TaskGraphInterfaces.h"
 #include "ECFRunAsyncAndWait.generated.h"
@@ -20,28 +22,22 @@ class ENHANCEDCODEFLOW_API UECFRunAsyncAndWait: public UECFCoroutineActionBase
 
 protected:
 
-	TUniqueFunction<void()> AsyncTaskFunc;
+	TUniqueFunction<void(const FECFCancellationToken&)> AsyncTaskFunc;
+	FECFCancellationToken CancellationToken;
 	float TimeOut = 0.f;
 	bool bWithTimeOut = false;
 
-	ENamedThreads::Type ThreadType = ENamedThreads::AnyBackgroundThreadNormalTask;
-	TAtomic<bool> bIsAsyncTaskDone = false;
+	FECFAsyncExecutor Executor;
+	bool bIsAsyncTaskDone = false;
 
-	bool Setup(TUniqueFunction<void()>&& InAsyncTaskFunc, float InTimeOut, EECFAsyncPrio InThreadPriority)
+	bool Setup(TUniqueFunction<void(const FECFCancellationToken&)>&& InAsyncTaskFunc, float InTimeOut, const FECFAsyncExecutor& InExecutor)
 	{
 		AsyncTaskFunc = MoveTemp(InAsyncTaskFunc);
 
-		switch (InThreadPriority)
-		{
-			case EECFAsyncPrio::Normal:
-				ThreadType = ENamedThreads::AnyBackgroundThreadNormalTask;
-				break;
-			case EECFAsyncPrio::HiPriority:
-				ThreadType = ENamedThreads::AnyBackgroundHiPriTask;
-				break;
-		}
+		Executor = InExecutor;
 
-		if (AsyncTaskFunc)
+		UECFSubsystem* ECF = Cast<UECFSubsystem>(GetOuter());
+		if (AsyncTaskFunc && ECF)
 		{
 			if (InTimeOut > 0.f)
 			{
@@ -56,13 +52,24 @@ protected:
 
 			bIsAsyncTaskDone = false;
 
+			// Without time out and first delay there is nothing to tick until the async task finishes.
+			SetWaitingForEvent(bWithTimeOut == false && Settings.GetFirstDelay() <= 0.f);
+
+			// When the task is done the worker doesn't change this action's state. It only notifies the subsystem, 
+			// which will wake this action up in it's next tick.
 			TWeakObjectPtr<ThisClass> WeakThis(this);
-			AsyncTask(ThreadType, [WeakThis]()
+			TSharedPtr<UECFSubsystem::FAsyncCompletionQueue, ESPMode::ThreadSafe> CompletionQueue = ECF->AsyncCompletionQueue;
+			const FECFHandle ThisHandleId = GetHandleId();
+			Executor.Launch([WeakThis, CompletionQueue, ThisHandleId, Token = CancellationToken]()
 			{
-				if (ThisClass* StrongThis = WeakThis.Get())
+				// Don't even start the task if the action has ended before the worker picked it up.
+				if (Token.IsCancelled() == false)
 				{
-					StrongThis->AsyncTaskFunc();
-					StrongThis->bIsAsyncTaskDone = true;
+					if (ThisClass* StrongThis = WeakThis.Get())
+					{
+						StrongThis->AsyncTaskFunc(Token);
+						CompletionQueue->Enqueue(ThisHandleId);
+					}
 				}
 			});
 
@@ -75,6 +82,19 @@ protected:
 		}
 	}
 
+	void ActionRemoved() override
+	{
+		// Let the async task know it is no longer needed.
+		CancellationToken.Cancel();
+		Super::ActionRemoved();
+	}
+
+	void AsyncTaskFinished() override
+	{
+		bIsAsyncTaskDone = true;
+		SetWaitingForEvent(false);
+	}
+
 	void Tick(float DeltaTime) override
 	{
 #if STATS
@@ -85,6 +105,7 @@ protected:
 			TimeOut -= DeltaTime;
 			if (TimeOut <= 0.f)
 			{
+				CancellationToken.Cancel();
 				Complete(false);
 				MarkAsFinished();
 				return;
@@ -100,7 +121,7 @@ protected:
 
 	void Complete(bool bStopped) override
 	{
-		CoroutineHandle.resume();
+		ResumeCoroutine();
 	}
 };
 
@@ -0,0 +1,111 @@
+// Copyright (c) 2024 Damian Nowakowski. All rights reserved.
+
+#pragma once
+
+#include "Coroutines/ECFCoroutineActionBase.h"
+#include "Coroutines/ECFDelegateBinding.h"
+#include "ECFWaitForDelegate.generated.h"
+
+ECF_PRAGMA_DISABLE_OPTIMIZATION
+
+UCLASS()
+class ENHANCEDCODEFLOW_API UECFWaitForDelegate : public UECFCoroutineActionBase
+{
+	GENERATED_BODY()
+
+	friend class UECFSubsystem;
+
+protected:
+
+	TUniquePtr<FECFDelegateBinding> Binding;
+	TSharedPtr<bool> bTimedOut;
+	float TimeOut = 0.f;
+	bool bWithTimeOut = false;
+
+	bool Setup(TUniquePtr<FECFDelegateBinding>&& InBinding, float InTimeOut, const TSharedPtr<bool>& InTimedOut)
+	{
+		Binding = MoveTemp(InBinding);
+		bTimedOut = InTimedOut;
+
+		if (Binding && bTimedOut.IsValid())
+		{
+			*bTimedOut = false;
+			if (InTimeOut > 0.f)
+			{
+				bWithTimeOut = true;
+				TimeOut = InTimeOut;
+				SetMaxActionTime(TimeOut);
+			}
+			else
+			{
+				bWithTimeOut = false;
+			}
+
+			// Without the timeout there is nothing to tick, the delegate will wake this action up.
+			SetWaitingForEvent(bWithTimeOut == false);
+			Binding->Bind(this, GET_FUNCTION_NAME_CHECKED(UECFWaitForDelegate, OnDelegateFired), [this]()
+			{
+				OnDelegateFired();
+			});
+			return true;
+		}
+		else
+		{
+			ensureMsgf(false, TEXT("ECF Coroutine - Wait For Delegate failed to start. Are you sure the Delegate is set properly?"));
+			return false;
+		}
+	}
+
+	void ActionRemoved() override
+	{
+		UnbindDelegate();
+		Super::ActionRemoved();
+	}
+
+	void Tick(float DeltaTime) override
+	{
+#if STATS
+		DECLARE_SCOPE_CYCLE_COUNTER(TEXT("WaitForDelegate - Tick"), STAT_ECFDETAILS_WAITFORDELEGATE, STATGROUP_ECFDETAILS);
+#endif
+		if (bWithTimeOut)
+		{
+			TimeOut -= DeltaTime;
+			if (TimeOut <= 0.f)
+			{
+				*bTimedOut = true;
+				Complete(false);
+				MarkAsFinished();
+			}
+		}
+	}
+
+	void Complete(bool bStopped) override
+	{
+		UnbindDelegate();
+		ResumeCoroutine();
+	}
+
+	// Bound to the awaited delegate. Resumes the coroutine right away, inside the delegate's broadcast.
+	UFUNCTION()
+	void OnDelegateFired()
+	{
+		if (IsValid())
+		{
+			Complete(false);
+			MarkAsFinished();
+		}
+	}
+
+private:
+
+	void UnbindDelegate()
+	{
+		if (Binding)
+		{
+			Binding->Unbind();
+			Binding.Reset();
+		}
+	}
+};
+
+ECF_PRAGMA_ENABLE_OPTIMIZATION
@@ -58,7 +58,7 @@ protected:
 
 	void Complete(bool bStopped) override
 	{
-		CoroutineHandle.resume();
+		ResumeCoroutine();
 	}
 };
 
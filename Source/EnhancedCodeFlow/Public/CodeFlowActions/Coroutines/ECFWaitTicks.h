@@ -54,7 +54,7 @@ protected:
 
 	void Complete(bool bStopped) override
 	{
-		CoroutineHandle.resume();
+		ResumeCoroutine();
 	}
 };
 
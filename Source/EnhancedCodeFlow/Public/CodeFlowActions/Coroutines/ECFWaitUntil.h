@@ -28,7 +28,7 @@ protected:
 		{
 			if (Predicate(0.f))
 			{
-				CoroutineHandle.resume();
+				ResumeCoroutine();
 				return false;
 			}
 			if (InTimeOut > 0.f)
@@ -75,7 +75,7 @@ protected:
 
 	void Complete(bool bStopped) override
 	{
-		CoroutineHandle.resume();
+		ResumeCoroutine();
 	}
 };
 
@@ -0,0 +1,154 @@
+// Copyright (c) 2024 Damian Nowakowski. All rights reserved.
+
+#pragma once
+
+#include "Coroutines/ECFCoroutineActionBase.h"
+#include "Coroutines/ECFWaitConditions.h"
+#include "ECFWhenAllAny.generated.h"
+
+ECF_PRAGMA_DISABLE_OPTIMIZATION
+
+UCLASS()
+class ENHANCEDCODEFLOW_API UECFWhenAllAny : public UECFCoroutineActionBase
+{
+	GENERATED_BODY()
+
+	friend class UECFSubsystem;
+
+protected:
+
+	TArray<TUniquePtr<FECFWaitCondition>> Conditions;
+	TBitArray<> MetConditions;
+	TSharedPtr<int32> WinnerIndex;
+	bool bWaitForAll = false;
+
+	bool Setup(TArray<TUniquePtr<FECFWaitCondition>>&& InConditions, bool bInWaitForAll, const TSharedPtr<int32>& InWinnerIndex)
+	{
+		Conditions = MoveTemp(InConditions);
+		bWaitForAll = bInWaitForAll;
+		WinnerIndex = InWinnerIndex;
+
+		UECFSubsystem* ECF = Cast<UECFSubsystem>(GetOuter());
+		if (Conditions.Num() > 0 && WinnerIndex.IsValid() && ECF)
+		{
+			*WinnerIndex = INDEX_NONE;
+			MetConditions.Init(false, Conditions.Num());
+
+			for (int32 ConditionId = 0; ConditionId < Conditions.Num(); ConditionId++)
+			{
+				if (Conditions[ConditionId]->Start(ECF, GetHandleId()))
+				{
+					MetConditions[ConditionId] = true;
+					if (bWaitForAll == false)
+					{
+						// The condition is already met, there is no need to start the action at all.
+						*WinnerIndex = ConditionId;
+						CancelConditions();
+						ResumeCoroutine();
+						return false;
+					}
+				}
+			}
+
+			if (bWaitForAll && (MetConditions.Find(false) == INDEX_NONE))
+			{
+				ResumeCoroutine();
+				return false;
+			}
+
+			UpdateWaitingForEvent();
+			return true;
+		}
+		else
+		{
+			ensureMsgf(false, TEXT("ECF Coroutine - When All/Any failed to start. Are you sure there is at least one awaiter given?"));
+			return false;
+		}
+	}
+
+	void ActionRemoved() override
+	{
+		CancelConditions();
+		Super::ActionRemoved();
+	}
+
+	void AsyncTaskFinished() override
+	{
+		SetWaitingForEvent(false);
+	}
+
+	void Tick(float DeltaTime) override
+	{
+#if STATS
+		DECLARE_SCOPE_CYCLE_COUNTER(TEXT("WhenAllAny - Tick"), STAT_ECFDETAILS_WHENALLANY, STATGROUP_ECFDETAILS);
+#endif
+		bool bAllMet = true;
+		for (int32 ConditionId = 0; ConditionId < Conditions.Num(); ConditionId++)
+		{
+			if (MetConditions[ConditionId] == false)
+			{
+				if (Conditions[ConditionId]->Tick(DeltaTime))
+				{
+					MetConditions[ConditionId] = true;
+					if (bWaitForAll == false)
+					{
+						*WinnerIndex = ConditionId;
+						CancelConditions();
+						Complete(false);
+						MarkAsFinished();
+						return;
+					}
+				}
+				else
+				{
+					bAllMet = false;
+				}
+			}
+		}
+
+		if (bAllMet)
+		{
+			Complete(false);
+			MarkAsFinished();
+		}
+		else
+		{
+			UpdateWaitingForEvent();
+		}
+	}
+
+	void Complete(bool bStopped) override
+	{
+		ResumeCoroutine();
+	}
+
+private:
+
+	// Lets conditions which are not met yet know they are no longer needed.
+	void CancelConditions()
+	{
+		for (int32 ConditionId = 0; ConditionId < Conditions.Num(); ConditionId++)
+		{
+			if (MetConditions[ConditionId] == false)
+			{
+				Conditions[ConditionId]->Cancel();
+			}
+		}
+	}
+
+	// When every remaining condition waits for an event, this action doesn't need to tick until the event comes.
+	void UpdateWaitingForEvent()
+	{
+		bool bOnlyEventsLeft = Settings.GetFirstDelay() <= 0.f;
+		for (int32 ConditionId = 0; (ConditionId < Conditions.Num()) && bOnlyEventsLeft; ConditionId++)
+		{
+			if (MetConditions[ConditionId] == false)
+			{
+				bOnlyEventsLeft = Conditions[ConditionId]->IsWaitingForEvent();
+			}
+		}
+		SetWaitingForEvent(bOnlyEventsLeft);
+	}
+};
+
+ECF_PRAGMA_ENABLE_OPTIMIZATION
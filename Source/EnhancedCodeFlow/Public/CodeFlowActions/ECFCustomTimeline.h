@@ -19,8 +19,7 @@ class ENHANCEDCODEFLOW_API UECFCustomTimeline : public UECFActionBase
 protected:
 
 	TUniqueFunction<void(float, float)> TickFunc;
-	TUniqueFunction<void(float, float, bool)> CallbackFunc;
-	TUniqueFunction<void(float, float)> CallbackFunc_NoStopped;
+	TECFCallback<void(float, float, bool)> CallbackFunc;
 	FTimeline MyTimeline;
 
 	float CurrentValue = 0.f;
@@ -29,10 +28,11 @@ protected:
 	UPROPERTY(Transient)
 	UCurveFloat* CurveFloat = nullptr;
 
-	bool Setup(UCurveFloat* InCurveFloat, TUniqueFunction<void(float, float)>&& InTickFunc, TUniqueFunction<void(float, float, bool)>&& InCallbackFunc = nullptr)
+	template<typename FuncType = TYPE_OF_NULLPTR>
+	bool Setup(UCurveFloat* InCurveFloat, TUniqueFunction<void(float, float)>&& InTickFunc, FuncType&& InCallbackFunc = nullptr)
 	{
 		TickFunc = MoveTemp(InTickFunc);
-		CallbackFunc = MoveTemp(InCallbackFunc);
+		CallbackFunc = Forward<FuncType>(InCallbackFunc);
 		CurveFloat = InCurveFloat;
 
 		if (TickFunc && CurveFloat)
@@ -56,18 +56,6 @@ protected:
 		}
 	}
 
-	bool Setup(UCurveFloat* InCurveFloat, TUniqueFunction<void(float, float)>&& InTickFunc, TUniqueFunction<void(float, float)>&& InCallbackFunc = nullptr)
-	{
-		CallbackFunc_NoStopped = MoveTemp(InCallbackFunc);
-		return Setup(InCurveFloat, MoveTemp(InTickFunc), [this](float Value, float Time, bool bStopped)
-		{
-			if (CallbackFunc_NoStopped)
-			{
-				CallbackFunc_NoStopped(Value, Time);
-			}
-		});
-	}
-
 	void Tick(float DeltaTime) override
 	{
 #if STATS
@@ -76,6 +64,11 @@ protected:
 		MyTimeline.TickTimeline(DeltaTime);
 	}
 
+	void RemoveTickFunc() override
+	{
+		TickFunc = nullptr;
+	}
+
 	void Complete(bool bStopped) override
 	{
 		if (CallbackFunc)
@@ -91,7 +84,7 @@ private:
 	{
 		CurrentValue = Value;
 		CurrentTime = MyTimeline.GetPlaybackPosition();
-		if (HasValidOwner())
+		if (HasValidOwner() && TickFunc)
 		{
 			TickFunc(CurrentValue, CurrentTime);
 		}
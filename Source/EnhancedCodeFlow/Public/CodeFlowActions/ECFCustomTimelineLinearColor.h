@@ -19,8 +19,7 @@ class ENHANCEDCODEFLOW_API UECFCustomTimelineLinearColor : public UECFActionBase
 protected:
 
 	TUniqueFunction<void(FLinearColor, float)> TickFunc;
-	TUniqueFunction<void(FLinearColor, float, bool)> CallbackFunc;
-	TUniqueFunction<void(FLinearColor, float)> CallbackFunc_NoStopped;
+	TECFCallback<void(FLinearColor, float, bool)> CallbackFunc;
 	FTimeline MyTimeline;
 
 	FLinearColor CurrentValue = FLinearColor::Black;
@@ -29,10 +28,11 @@ protected:
 	UPROPERTY(Transient)
 	UCurveLinearColor* CurveLinearColor = nullptr;
 
-	bool Setup(UCurveLinearColor* InCurveLinearColor, TUniqueFunction<void(FLinearColor, float)>&& InTickFunc, TUniqueFunction<void(FLinearColor, float, bool)>&& InCallbackFunc = nullptr)
+	template<typename FuncType = TYPE_OF_NULLPTR>
+	bool Setup(UCurveLinearColor* InCurveLinearColor, TUniqueFunction<void(FLinearColor, float)>&& InTickFunc, FuncType&& InCallbackFunc = nullptr)
 	{
 		TickFunc = MoveTemp(InTickFunc);
-		CallbackFunc = MoveTemp(InCallbackFunc);
+		CallbackFunc = Forward<FuncType>(InCallbackFunc);
 		CurveLinearColor = InCurveLinearColor;
 
 		if (TickFunc && CurveLinearColor)
@@ -56,18 +56,6 @@ protected:
 		}
 	}
 
-	bool Setup(UCurveLinearColor* InCurveLinearColor, TUniqueFunction<void(FLinearColor, float)>&& InTickFunc, TUniqueFunction<void(FLinearColor, float)>&& InCallbackFunc = nullptr)
-	{
-		CallbackFunc_NoStopped = MoveTemp(InCallbackFunc);
-		return Setup(InCurveLinearColor, MoveTemp(InTickFunc), [this](FLinearColor Value, float Time, bool bStopped)
-		{
-			if (CallbackFunc_NoStopped)
-			{
-				CallbackFunc_NoStopped(Value, Time);
-			}
-		});
-	}
-
 	void Tick(float DeltaTime) override
 	{
 #if STATS
@@ -76,6 +64,11 @@ protected:
 		MyTimeline.TickTimeline(DeltaTime);
 	}
 
+	void RemoveTickFunc() override
+	{
+		TickFunc = nullptr;
+	}
+
 	void Complete(bool bStopped) override
 	{
 		if (CallbackFunc)
@@ -91,7 +84,7 @@ private:
 	{
 		CurrentValue = Value;
 		CurrentTime = MyTimeline.GetPlaybackPosition();
-		if (HasValidOwner())
+		if (HasValidOwner() && TickFunc)
 		{
 			TickFunc(CurrentValue, CurrentTime);
 		}
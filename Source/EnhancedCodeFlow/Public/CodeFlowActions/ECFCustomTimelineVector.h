@@ -19,8 +19,7 @@ class ENHANCEDCODEFLOW_API UECFCustomTimelineVector : public UECFActionBase
 protected:
 
 	TUniqueFunction<void(FVector, float)> TickFunc;
-	TUniqueFunction<void(FVector, float, bool)> CallbackFunc;
-	TUniqueFunction<void(FVector, float)> CallbackFunc_NoStopped;
+	TECFCallback<void(FVector, float, bool)> CallbackFunc;
 	FTimeline MyTimeline;
 
 	FVector CurrentValue = FVector::ZeroVector;
@@ -29,10 +28,11 @@ protected:
 	UPROPERTY(Transient)
 	UCurveVector* CurveVector = nullptr;
 
-	bool Setup(UCurveVector* InCurveVector, TUniqueFunction<void(FVector, float)>&& InTickFunc, TUniqueFunction<void(FVector, float, bool)>&& InCallbackFunc = nullptr)
+	template<typename FuncType = TYPE_OF_NULLPTR>
+	bool Setup(UCurveVector* InCurveVector, TUniqueFunction<void(FVector, float)>&& InTickFunc, FuncType&& InCallbackFunc = nullptr)
 	{
 		TickFunc = MoveTemp(InTickFunc);
-		CallbackFunc = MoveTemp(InCallbackFunc);
+		CallbackFunc = Forward<FuncType>(InCallbackFunc);
 		CurveVector = InCurveVector;
 
 		if (TickFunc && CurveVector)
@@ -56,18 +56,6 @@ protected:
 		}
 	}
 
-	bool Setup(UCurveVector* InCurveVector, TUniqueFunction<void(FVector, float)>&& InTickFunc, TUniqueFunction<void(FVector, float)>&& InCallbackFunc = nullptr)
-	{
-		CallbackFunc_NoStopped = MoveTemp(InCallbackFunc);
-		return Setup(InCurveVector, MoveTemp(InTickFunc), [this](FVector Value, float Time, bool bStopped)
-		{
-			if (CallbackFunc_NoStopped)
-			{
-				CallbackFunc_NoStopped(Value, Time);
-			}
-		});
-	}
-
 	void Tick(float DeltaTime) override
 	{
 #if STATS
@@ -76,6 +64,11 @@ protected:
 		MyTimeline.TickTimeline(DeltaTime);
 	}
 
+	void RemoveTickFunc() override
+	{
+		TickFunc = nullptr;
+	}
+
 	void Complete(bool bStopped) override
 	{
 		if (CallbackFunc)
@@ -91,7 +84,7 @@ private:
 	{
 		CurrentValue = Value;
 		CurrentTime = MyTimeline.GetPlaybackPosition();
-		if (HasValidOwner())
+		if (HasValidOwner() && TickFunc)
 		{
 			TickFunc(CurrentValue, CurrentTime);
 		}
@@ -16,15 +16,15 @@ class ENHANCEDCODEFLOW_API UECFDelay : public UECFActionBase
 
 protected:
 
-	TUniqueFunction<void(bool)> CallbackFunc;
-	TUniqueFunction<void()> CallbackFunc_NoStopped;
+	TECFCallback<void(bool)> CallbackFunc;
 	float DelayTime = 0.f;
 	float CurrentTime = 0.f;
 
-	bool Setup(float InDelayTime, TUniqueFunction<void(bool)>&& InCallbackFunc)
+	template<typename FuncType>
+	bool Setup(float InDelayTime, FuncType&& InCallbackFunc)
 	{
 		DelayTime = InDelayTime;
-		CallbackFunc = MoveTemp(InCallbackFunc);
+		CallbackFunc = Forward<FuncType>(InCallbackFunc);
 
 		if (CallbackFunc && DelayTime >= 0)
 		{
@@ -41,23 +41,6 @@ protected:
 		}
 	}
 
-	bool Setup(float InDelayTime, TUniqueFunction<void()>&& InCallbackFunc)
-	{
-		CallbackFunc_NoStopped = MoveTemp(InCallbackFunc);
-		if (CallbackFunc_NoStopped)
-		{
-			return Setup(InDelayTime, [this](bool bStopped)
-			{
-				CallbackFunc_NoStopped();
-			});			
-		}
-		else
-		{
-			ensureMsgf(false, TEXT("ECF - delay failed to start. Are you sure the Callback Function is set properly?"));
-			return false;
-		}
-	}
-
 	void Init() override
 	{
 		CurrentTime = 0;
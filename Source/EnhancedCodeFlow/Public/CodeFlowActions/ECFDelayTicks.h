@@ -16,15 +16,15 @@ class ENHANCEDCODEFLOW_API UECFDelayTicks : public UECFActionBase
 
 protected:
 
-	TUniqueFunction<void(bool)> CallbackFunc;
-	TUniqueFunction<void()> CallbackFunc_NoStopped;
+	TECFCallback<void(bool)> CallbackFunc;
 	int32 DelayTicks = 0;
 	int32 CurrentTicks = 0;
 
-	bool Setup(int32 InDelayTicks, TUniqueFunction<void(bool)>&& InCallbackFunc)
+	template<typename FuncType>
+	bool Setup(int32 InDelayTicks, FuncType&& InCallbackFunc)
 	{
 		DelayTicks = InDelayTicks;
-		CallbackFunc = MoveTemp(InCallbackFunc);
+		CallbackFunc = Forward<FuncType>(InCallbackFunc);
 
 		if (CallbackFunc && DelayTicks >= 0)
 		{
@@ -37,23 +37,6 @@ protected:
 		}
 	}
 
-	bool Setup(int32 InDelayTicks, TUniqueFunction<void()>&& InCallbackFunc)
-	{
-		CallbackFunc_NoStopped = MoveTemp(InCallbackFunc);
-		if (CallbackFunc_NoStopped)
-		{
-			return Setup(InDelayTicks, [this](bool bStopped)
-			{
-				CallbackFunc_NoStopped();
-			});
-		}
-		else
-		{
-			ensureMsgf(false, TEXT("ECF - delay ticks failed to start. Are you sure the Callback Function is set properly?"));
-			return false;
-		}
-	}
-
 	void Init() override
 	{
 		CurrentTicks = 0;
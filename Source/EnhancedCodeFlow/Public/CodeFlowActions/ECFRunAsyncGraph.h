@@ -0,0 +1,118 @@
+// Copyright (c) 2024 Damian Nowakowski. All rights reserved.
+
+#pragma once
+
+#include "ECFActionBase.h"
+#include "ECFSubsystem.h"
+#include "ECFAsyncGraph.h"
+#include "ECFCancellationToken.h"
+#include "ECFRunAsyncGraph.generated.h"
+
+ECF_PRAGMA_DISABLE_OPTIMIZATION
+
+UCLASS()
+class ENHANCEDCODEFLOW_API UECFRunAsyncGraph : public UECFActionBase
+{
+	GENERATED_BODY()
+
+	friend class UECFSubsystem;
+
+protected:
+
+	FECFCancellationToken CancellationToken;
+	TECFCallback<void(bool, bool)> Func;
+
+	float TimeOut = 0.f;
+	bool bWithTimeOut = false;
+	bool bTimedOut = false;
+
+	bool bIsAsyncTaskDone = false;
+
+	template<typename FuncType>
+	bool Setup(FECFAsyncGraph&& InGraph, FuncType&& InFunc, float InTimeOut)
+	{
+		Func = Forward<FuncType>(InFunc);
+
+		UECFSubsystem* ECF = Cast<UECFSubsystem>(GetOuter());
+		if (InGraph.IsValid() && Func && ECF)
+		{
+			if (InTimeOut > 0.f)
+			{
+				bWithTimeOut = true;
+				bTimedOut = false;
+				TimeOut = InTimeOut;
+				SetMaxActionTime(TimeOut);
+			}
+			else
+			{
+				bWithTimeOut = false;
+				bTimedOut = false;
+			}
+
+			bIsAsyncTaskDone = false;
+
+			// Without time out and first delay there is nothing to tick until the whole graph finishes.
+			SetWaitingForEvent(bWithTimeOut == false && Settings.GetFirstDelay() <= 0.f);
+
+			// Stages are launching each other on workers. Only the end of the last one is passed to the subsystem,
+			// which will wake this action up in it's next tick.
+			TSharedPtr<UECFSubsystem::FAsyncCompletionQueue, ESPMode::ThreadSafe> CompletionQueue = ECF->AsyncCompletionQueue;
+			const FECFHandle ThisHandleId = GetHandleId();
+			FECFAsyncGraph::Launch(MakeShared<FECFAsyncGraph, ESPMode::ThreadSafe>(MoveTemp(InGraph)), CancellationToken, [CompletionQueue, ThisHandleId]()
+			{
+				CompletionQueue->Enqueue(ThisHandleId);
+			});
+
+			return true;
+		}
+		else
+		{
+			ensureMsgf(false, TEXT("ECF - Run Async Graph failed to start. Are you sure the Graph has stages and the Function is set properly?"));
+			return false;
+		}
+	}
+
+	void ActionRemoved() override
+	{
+		// Let the remaining stages know they are no longer needed.
+		CancellationToken.Cancel();
+	}
+
+	void AsyncTaskFinished() override
+	{
+		bIsAsyncTaskDone = true;
+		SetWaitingForEvent(false);
+	}
+
+	void Tick(float DeltaTime) override
+	{
+#if STATS
+		DECLARE_SCOPE_CYCLE_COUNTER(TEXT("RunAsyncGraph - Tick"), STAT_ECFDETAILS_RUNASYNCGRAPH, STATGROUP_ECFDETAILS);
+#endif
+		if (bWithTimeOut)
+		{
+			TimeOut -= DeltaTime;
+			if (TimeOut <= 0.f)
+			{
+				CancellationToken.Cancel();
+				bTimedOut = true;
+				Complete(false);
+				MarkAsFinished();
+				return;
+			}
+		}
+
+		if (bIsAsyncTaskDone)
+		{
+			Complete(false);
+			MarkAsFinished();
+		}
+	}
+
+	void Complete(bool bStopped) override
+	{
+		Func(bTimedOut, bStopped);
+	}
+};
+
+ECF_PRAGMA_ENABLE_OPTIMIZATION
@@ -3,8 +3,10 @@
 #pragma once
 
 #include "ECFActionBase.h"
-#include "Templates/Atomic.h"
 #include "Async/Async.h"
+#include "ECFSubsystem.h"
+#include "ECFCancellationToken.h"
+#include "ECFAsyncExecutor.h"
 #include "ECFTypes.h"
 #include "Async/TaskGraphInterfaces.h"
 #include "ECFRunAsyncThen.generated.h"
@@ -20,34 +22,25 @@ class ENHANCEDCODEFLOW_API UECFRunAsyncThen : public UECFActionBase
 
 protected:
 
-	TUniqueFunction<void()> AsyncTaskFunc;
-	TUniqueFunction<void(bool, bool)> Func;
-	TUniqueFunction<void(bool)> Func_NoStopped;
-	TUniqueFunction<void()> Func_NoTimeOut_NoStopped;
+	FECFCancellationToken CancellationToken;
+	TECFCallback<void(bool, bool)> Func;
 
 	float TimeOut = 0.f;
 	bool bWithTimeOut = false;
 	bool bTimedOut = false;
 
-	ENamedThreads::Type ThreadType = ENamedThreads::AnyBackgroundThreadNormalTask;
-	TAtomic<bool> bIsAsyncTaskDone = false;
+	FECFAsyncExecutor Executor;
+	bool bIsAsyncTaskDone = false;
 
-	bool Setup(TUniqueFunction<void()>&& InAsyncTaskFunc, TUniqueFunction<void(bool, bool)>&& InFunc, float InTimeOut, EECFAsyncPrio ThreadPriority)
+	template<typename FuncType>
+	bool Setup(TUniqueFunction<void(const FECFCancellationToken&)>&& InAsyncTaskFunc, FuncType&& InFunc, float InTimeOut, const FECFAsyncExecutor& InExecutor)
 	{
-		AsyncTaskFunc = MoveTemp(InAsyncTaskFunc);
-		Func = MoveTemp(InFunc);
+		Func = Forward<FuncType>(InFunc);
 
-		switch (ThreadPriority)
-		{
-			case EECFAsyncPrio::Normal:
-				ThreadType = ENamedThreads::AnyBackgroundThreadNormalTask;
-				break;
-			case EECFAsyncPrio::HiPriority:
-				ThreadType = ENamedThreads::AnyBackgroundHiPriTask;
-				break;
-		}
+		Executor = InExecutor;
 
-		if (AsyncTaskFunc && Func)
+		UECFSubsystem* ECF = Cast<UECFSubsystem>(GetOuter());
+		if (InAsyncTaskFunc && Func && ECF)
 		{
 			if (InTimeOut > 0.f)	
 			{
@@ -64,13 +57,21 @@ protected:
 
 			bIsAsyncTaskDone = false;
 
-			TWeakObjectPtr<ThisClass> WeakThis(this);
-			AsyncTask(ThreadType, [WeakThis]()
+			// Without time out and first delay there is nothing to tick until the async task finishes.
+			SetWaitingForEvent(bWithTimeOut == false && Settings.GetFirstDelay() <= 0.f);
+
+			// When the task is done the worker doesn't change this action's state. It only notifies the subsystem, 
+			// which will wake this action up in it's next tick.
+			// The task function is moved to the worker, so it stays valid even if this action is gone before the task ends.
+			TSharedPtr<UECFSubsystem::FAsyncCompletionQueue, ESPMode::ThreadSafe> CompletionQueue = ECF->AsyncCompletionQueue;
+			const FECFHandle ThisHandleId = GetHandleId();
+			Executor.Launch([TaskFunc = MoveTemp(InAsyncTaskFunc), CompletionQueue, ThisHandleId, Token = CancellationToken]()
 			{
-				if (ThisClass* StrongThis = WeakThis.Get())
+				// Don't even start the task if the action has ended before the worker picked it up.
+				if (Token.IsCancelled() == false)
 				{
-					StrongThis->AsyncTaskFunc();
-					StrongThis->bIsAsyncTaskDone = true;
+					TaskFunc(Token);
+					CompletionQueue->Enqueue(ThisHandleId);
 				}
 			});
 
@@ -83,41 +84,19 @@ protected:
 		}
 	}
 
-	bool Setup(TUniqueFunction<void()>&& InAsyncTaskFunc, TUniqueFunction<void(bool)>&& InFunc, float InTimeOut, EECFAsyncPrio ThreadPriority)
+
+	void ActionRemoved() override
 	{
-		Func_NoStopped = MoveTemp(InFunc);
-		if (Func_NoStopped)
-		{
-			return Setup(MoveTemp(InAsyncTaskFunc), [this](bool bTimeOut, bool bStopped)
-			{
-				Func_NoStopped(bTimeOut);
-			}, InTimeOut, ThreadPriority);
-		}
-		else
-		{
-			ensureMsgf(false, TEXT("ECF - Run Async Task and Run failed to start. Are you sure the Function is set properly?"));
-			return false;
-		}
+		// Let the async task know it is no longer needed.
+		CancellationToken.Cancel();
 	}
 
-	bool Setup(TUniqueFunction<void()>&& InAsyncTaskFunc, TUniqueFunction<void()>&& InFunc, float InTimeOut, EECFAsyncPrio ThreadPriority)
+	void AsyncTaskFinished() override
 	{
-		Func_NoTimeOut_NoStopped = MoveTemp(InFunc);
-		if (Func_NoTimeOut_NoStopped)
-		{
-			return Setup(MoveTemp(InAsyncTaskFunc), [this](bool bTimeOut, bool bStopped)
-			{
-				Func_NoTimeOut_NoStopped();
-			}, InTimeOut, ThreadPriority);
-		}
-		else
-		{
-			ensureMsgf(false, TEXT("ECF - Run Async Task and Run failed to start. Are you sure the Function is set properly?"));
-			return false;
-		}
+		bIsAsyncTaskDone = true;
+		SetWaitingForEvent(false);
 	}
 
-
 	void Tick(float DeltaTime) override 
 	{
 #if STATS
@@ -128,6 +107,7 @@ protected:
 			TimeOut -= DeltaTime;
 			if (TimeOut <= 0.f)
 			{
+				CancellationToken.Cancel();
 				bTimedOut = true;
 				Complete(false);
 				MarkAsFinished();
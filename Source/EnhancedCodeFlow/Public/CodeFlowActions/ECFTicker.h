@@ -17,16 +17,16 @@ class ENHANCEDCODEFLOW_API UECFTicker : public UECFActionBase
 protected:
 
 	TUniqueFunction<void(float)> TickFunc;
-	TUniqueFunction<void(bool)> CallbackFunc;
-	TUniqueFunction<void()> CallbackFunc_NoStopped;
+	TECFCallback<void(bool)> CallbackFunc;
 	float TickingTime = 0.f;
 	float CurrentTime = 0.f;
 
-	bool Setup(float InTickingTime, TUniqueFunction<void(float)>&& InTickFunc, TUniqueFunction<void(bool)>&& InCallbackFunc = nullptr)
+	template<typename FuncType = TYPE_OF_NULLPTR>
+	bool Setup(float InTickingTime, TUniqueFunction<void(float)>&& InTickFunc, FuncType&& InCallbackFunc = nullptr)
 	{
 		TickingTime = InTickingTime;
 		TickFunc = MoveTemp(InTickFunc);
-		CallbackFunc = MoveTemp(InCallbackFunc);
+		CallbackFunc = Forward<FuncType>(InCallbackFunc);
 
 		if (TickFunc && (TickingTime > 0.f || TickingTime == -1.f))
 		{
@@ -45,24 +45,15 @@ protected:
 		}
 	}
 
-	bool Setup(float InTickingTime, TUniqueFunction<void(float)>&& InTickFunc, TUniqueFunction<void()>&& InCallbackFunc = nullptr)
-	{
-		CallbackFunc_NoStopped = MoveTemp(InCallbackFunc);
-		return Setup(InTickingTime, MoveTemp(InTickFunc), [this](bool bStopped)
-		{
-			if (CallbackFunc_NoStopped)
-			{
-				CallbackFunc_NoStopped();
-			}
-		});
-	}
-
 	void Tick(float DeltaTime) override
 	{
 #if STATS
 		DECLARE_SCOPE_CYCLE_COUNTER(TEXT("Ticker - Tick"), STAT_ECFDETAILS_TICKER, STATGROUP_ECFDETAILS);
 #endif
-		TickFunc(DeltaTime);
+		if (TickFunc)
+		{
+			TickFunc(DeltaTime);
+		}
 		CurrentTime += DeltaTime;
 		if (TickingTime > 0.f && CurrentTime >= TickingTime)
 		{
@@ -71,6 +62,11 @@ protected:
 		}
 	}
 
+	void RemoveTickFunc() override
+	{
+		TickFunc = nullptr;
+	}
+
 	void Complete(bool bStopped) override
 	{
 		if (CallbackFunc)
@@ -17,16 +17,16 @@ class ENHANCEDCODEFLOW_API UECFTicker_WithHandle : public UECFActionBase
 protected:
 
 	TUniqueFunction<void(float, FECFHandle)> TickFunc;
-	TUniqueFunction<void(bool)> CallbackFunc;
-	TUniqueFunction<void()> CallbackFunc_NoStopped;
+	TECFCallback<void(bool)> CallbackFunc;
 	float TickingTime = 0.f;
 	float CurrentTime = 0.f;
 
-	bool Setup(float InTickingTime, TUniqueFunction<void(float, FECFHandle)>&& InTickFunc, TUniqueFunction<void(bool)>&& InCallbackFunc = nullptr)
+	template<typename FuncType = TYPE_OF_NULLPTR>
+	bool Setup(float InTickingTime, TUniqueFunction<void(float, FECFHandle)>&& InTickFunc, FuncType&& InCallbackFunc = nullptr)
 	{
 		TickingTime = InTickingTime;
 		TickFunc = MoveTemp(InTickFunc);
-		CallbackFunc = MoveTemp(InCallbackFunc);
+		CallbackFunc = Forward<FuncType>(InCallbackFunc);
 
 		if (TickFunc && (TickingTime > 0.f || TickingTime == -1.f))
 		{
@@ -45,18 +45,6 @@ protected:
 		}
 	}
 
-	bool Setup(float InTickingTime, TUniqueFunction<void(float, FECFHandle)>&& InTickFunc, TUniqueFunction<void()>&& InCallbackFunc = nullptr)
-	{
-		CallbackFunc_NoStopped = MoveTemp(InCallbackFunc);
-		return Setup(InTickingTime, MoveTemp(InTickFunc), [this](bool bStopped)
-		{
-			if (CallbackFunc_NoStopped)
-			{
-				CallbackFunc_NoStopped();
-			}
-		});
-	}
-
 	void Tick(float DeltaTime) override
 	{
 #if STATS
@@ -3,6 +3,10 @@
 #pragma once
 
 #include "ECFActionBase.h"
+#include "ECFSubsystem.h"
+#include "ECFTimelineBatch.h"
+#include "ECFTimelineCore.h"
+#include "ECFTimelineSink.h"
 #include "ECFTypes.h"
 #include "ECFTimeline.generated.h"
 
@@ -14,37 +18,31 @@ class ENHANCEDCODEFLOW_API UECFTimeline : public UECFActionBase
 	GENERATED_BODY()
 
 	friend class UECFSubsystem;
+	friend class FECFTimelineBatch;
 
 protected:
 
 	TUniqueFunction<void(float, float)> TickFunc;
-	TUniqueFunction<void(float, float, bool)> CallbackFunc;
-	TUniqueFunction<void(float, float)> CallbackFunc_NoStopped;
-	float StartValue;
-	float StopValue;
-	float Time;
-	EECFBlendFunc BlendFunc;
-	float BlendExp;
-
-	float CurrentTime;
-	float CurrentValue;
-
-	bool Setup(float InStartValue, float InStopValue, float InTime, TUniqueFunction<void(float, float)>&& InTickFunc, TUniqueFunction<void(float, float, bool)>&& InCallbackFunc, EECFBlendFunc InBlendFunc, float InBlendExp)
-	{
-		StartValue = InStartValue;
-		StopValue = InStopValue;
-		Time = InTime;
+	TECFCallback<void(float, float, bool)> CallbackFunc;
+	TECFTimelineCore<float> MyTimeline;
 
-		TickFunc = MoveTemp(InTickFunc);
-		CallbackFunc = MoveTemp(InCallbackFunc);
+	// If set, the value is written to the sink instead of launching the TickFunc.
+	FECFTimelineSink Sink;
+
+	// The batch evaluating this timeline and the index of this timeline in it.
+	// If the batch is not set, the timeline evaluates itself in Tick.
+	FECFTimelineBatch* Batch = nullptr;
+	int32 BatchIndex = INDEX_NONE;
 
-		BlendFunc = InBlendFunc;
-		BlendExp = InBlendExp;
+	template<typename FuncType>
+	bool Setup(float InStartValue, float InStopValue, float InTime, TUniqueFunction<void(float, float)>&& InTickFunc, FuncType&& InCallbackFunc, EECFBlendFunc InBlendFunc, float InBlendExp)
+	{
+		TickFunc = MoveTemp(InTickFunc);
+		CallbackFunc = Forward<FuncType>(InCallbackFunc);
 
-		if (TickFunc && Time > 0 && BlendExp != 0 && StartValue != StopValue)
+		if (MyTimeline.Setup(InStartValue, InStopValue, InTime, InBlendFunc, InBlendExp) && (TickFunc || Sink.IsSet()))
 		{
-			SetMaxActionTime(Time);
-			CurrentTime = 0.f;
+			SetMaxActionTime(InTime);
 			return true;
 		}
 		else
@@ -54,16 +52,25 @@ protected:
 		}
 	}
 
-	bool Setup(float InStartValue, float InStopValue, float InTime, TUniqueFunction<void(float, float)>&& InTickFunc, TUniqueFunction<void(float, float)>&& InCallbackFunc, EECFBlendFunc InBlendFunc, float InBlendExp)
+	template<typename FuncType>
+	bool Setup(float InStartValue, float InStopValue, float InTime, FECFTimelineSink&& InSink, FuncType&& InCallbackFunc, EECFBlendFunc InBlendFunc, float InBlendExp)
 	{
-		CallbackFunc_NoStopped = MoveTemp(InCallbackFunc);
-		return Setup(InStartValue, InStopValue, InTime, MoveTemp(InTickFunc), [this](float FwdValue, float FwdTime, bool bStopped)
+		Sink = MoveTemp(InSink);
+		return Setup(InStartValue, InStopValue, InTime, TUniqueFunction<void(float, float)>(), Forward<FuncType>(InCallbackFunc), InBlendFunc, InBlendExp);
+	}
+
+	void Init() override
+	{
+		// The batch is evaluated with the subsystem's tick, so timelines of other tick groups are evaluated by themselves.
+		if (Settings.GetTickGroup() != EECFTickGroup::Default)
 		{
-			if (CallbackFunc_NoStopped)
-			{
-				CallbackFunc_NoStopped(FwdValue, FwdTime);
-			}
-		}, InBlendFunc, InBlendExp);
+			return;
+		}
+
+		if (UECFSubsystem* ECF = Cast<UECFSubsystem>(GetOuter()))
+		{
+			ECF->TimelineBatch.AddTimeline(this);
+		}
 	}
 
 	void Tick(float DeltaTime) override
@@ -71,41 +78,69 @@ protected:
 #if STATS
 		DECLARE_SCOPE_CYCLE_COUNTER(TEXT("Timeline - Tick"), STAT_ECFDETAILS_TIMELINE, STATGROUP_ECFDETAILS);
 #endif
-		CurrentTime = FMath::Clamp(CurrentTime + DeltaTime, 0.f, Time);
+		// Batched timeline only passes it's time to the batch. 
+		// The value will be evaluated after all actions are ticked.
+		if (Batch)
+		{
+			MyTimeline.AdvanceTime(DeltaTime);
+			Batch->SetCurrentTime(MyTimeline.BlendFunc, BatchIndex, MyTimeline.CurrentTime);
+			return;
+		}
+
+		const bool bFinished = MyTimeline.Tick(DeltaTime);
+
+		ApplyCurrentValue();
 
-		switch (BlendFunc)
+		if (bFinished)
 		{
-		case EECFBlendFunc::ECFBlend_Linear:
-			CurrentValue = FMath::Lerp(StartValue, StopValue, CurrentTime / Time);
-			break;
-		case EECFBlendFunc::ECFBlend_Cubic:
-			CurrentValue = FMath::CubicInterp(StartValue, 0.f, StopValue, 0.f, CurrentTime / Time);
-			break;
-		case EECFBlendFunc::ECFBlend_EaseIn:
-			CurrentValue = FMath::Lerp(StartValue, StopValue, FMath::Pow(CurrentTime / Time, BlendExp));
-			break;
-		case EECFBlendFunc::ECFBlend_EaseOut:
-			CurrentValue = FMath::Lerp(StartValue, StopValue, FMath::Pow(CurrentTime / Time, 1.f / BlendExp));
-			break;
-		case EECFBlendFunc::ECFBlend_EaseInOut:
-			CurrentValue = FMath::InterpEaseInOut(StartValue, StopValue, CurrentTime / Time, BlendExp);
-			break;
+			Complete(false);
+			MarkAsFinished();
 		}
+	}
+
+	// Called by the batch with the evaluated value of this timeline.
+	void TickBatched(float Value, float Alpha)
+	{
+		MyTimeline.CurrentValue = Value;
 
-		TickFunc(CurrentValue, CurrentTime);
+		ApplyCurrentValue();
 
-		if ((StopValue > StartValue && CurrentValue >= StopValue) || (StopValue < StartValue && CurrentValue <= StopValue))
+		if (Alpha >= 1.f)
 		{
 			Complete(false);
 			MarkAsFinished();
 		}
 	}
 
+	// Passes the current value to the sink or to the tick function.
+	void ApplyCurrentValue()
+	{
+		if (Sink.IsSet())
+		{
+			if (Sink.Write(MyTimeline.CurrentValue))
+			{
+				if (UECFSubsystem* ECF = Cast<UECFSubsystem>(GetOuter()))
+				{
+					ECF->TimelineBatch.QueueFlush(Sink.Flush);
+				}
+			}
+		}
+		else if (TickFunc)
+		{
+			TickFunc(MyTimeline.CurrentValue, MyTimeline.CurrentTime);
+		}
+	}
+
+	void RemoveTickFunc() override
+	{
+		TickFunc = nullptr;
+	}
+
 	void Complete(bool bStopped) override
 	{
 		if (CallbackFunc)
 		{
-			CallbackFunc(CurrentValue, CurrentTime, bStopped);
+			CallbackFunc(MyTimeline.CurrentValue, MyTimeline.CurrentTime, bStopped);
 		}
 	}
 };
@@ -3,6 +3,7 @@
 #pragma once
 
 #include "ECFActionBase.h"
+#include "ECFTimelineCore.h"
 #include "ECFTypes.h"
 #include "ECFTimelineLinearColor.generated.h"
 
@@ -18,33 +19,18 @@ class ENHANCEDCODEFLOW_API UECFTimelineLinearColor: public UECFActionBase
 protected:
 
 	TUniqueFunction<void(FLinearColor, float)> TickFunc;
-	TUniqueFunction<void(FLinearColor, float, bool)> CallbackFunc;
-	TUniqueFunction<void(FLinearColor, float)> CallbackFunc_NoStopped;
-	FLinearColor StartValue;
-	FLinearColor StopValue;
-	float Time;
-	EECFBlendFunc BlendFunc;
-	float BlendExp;
+	TECFCallback<void(FLinearColor, float, bool)> CallbackFunc;
+	TECFTimelineCore<FLinearColor> MyTimeline;
 
-	float CurrentTime;
-	FLinearColor CurrentValue;
-
-	bool Setup(FLinearColor InStartValue, FLinearColor InStopValue, float InTime, TUniqueFunction<void(FLinearColor, float)>&& InTickFunc, TUniqueFunction<void(FLinearColor, float, bool)>&& InCallbackFunc, EECFBlendFunc InBlendFunc, float InBlendExp)
+	template<typename FuncType>
+	bool Setup(FLinearColor InStartValue, FLinearColor InStopValue, float InTime, TUniqueFunction<void(FLinearColor, float)>&& InTickFunc, FuncType&& InCallbackFunc, EECFBlendFunc InBlendFunc, float InBlendExp)
 	{
-		StartValue = InStartValue;
-		StopValue = InStopValue;
-		Time = InTime;
-
 		TickFunc = MoveTemp(InTickFunc);
-		CallbackFunc = MoveTemp(InCallbackFunc);
-
-		BlendFunc = InBlendFunc;
-		BlendExp = InBlendExp;
+		CallbackFunc = Forward<FuncType>(InCallbackFunc);
 
-		if (TickFunc && Time > 0 && BlendExp != 0 && StartValue != StopValue)
+		if (MyTimeline.Setup(InStartValue, InStopValue, InTime, InBlendFunc, InBlendExp) && TickFunc)
 		{
-			SetMaxActionTime(Time);
-			CurrentTime = 0.f;
+			SetMaxActionTime(InTime);
 			return true;
 		}
 		else
@@ -54,60 +40,35 @@ protected:
 		}
 	}
 
-	bool Setup(FLinearColor InStartValue, FLinearColor InStopValue, float InTime, TUniqueFunction<void(FLinearColor, float)>&& InTickFunc, TUniqueFunction<void(FLinearColor, float)>&& InCallbackFunc, EECFBlendFunc InBlendFunc, float InBlendExp)
-	{
-		CallbackFunc_NoStopped = MoveTemp(InCallbackFunc);
-		return Setup(InStartValue, InStopValue, InTime, MoveTemp(InTickFunc), [this](FLinearColor FwdValue, float FwdTime, bool bStopped)
-		{
-			if (CallbackFunc_NoStopped)
-			{
-				CallbackFunc_NoStopped(FwdValue, FwdTime);
-			}
-		}, InBlendFunc, InBlendExp);
-	}
-
 	void Tick(float DeltaTime) override
 	{
 #if STATS
 		DECLARE_SCOPE_CYCLE_COUNTER(TEXT("Timeline Linear Color - Tick"), STAT_ECFDETAILS_TIMELINELINEARCOLOR, STATGROUP_ECFDETAILS);
 #endif
-		CurrentTime = FMath::Clamp(CurrentTime + DeltaTime, 0.f, Time);
-
-		const float LerpValue = CurrentTime / Time;
+		const bool bFinished = MyTimeline.Tick(DeltaTime);
 
-		switch (BlendFunc)
+		if (TickFunc)
 		{
-		case EECFBlendFunc::ECFBlend_Linear:
-			CurrentValue = FMath::Lerp(StartValue, StopValue, LerpValue);
-			break;
-		case EECFBlendFunc::ECFBlend_Cubic:
-			CurrentValue = FMath::CubicInterp(StartValue, FLinearColor::Black, StopValue, FLinearColor::Black, LerpValue);
-			break;
-		case EECFBlendFunc::ECFBlend_EaseIn:
-			CurrentValue = FMath::Lerp(StartValue, StopValue, FMath::Pow(LerpValue, BlendExp));
-			break;
-		case EECFBlendFunc::ECFBlend_EaseOut:
-			CurrentValue = FMath::Lerp(StartValue, StopValue, FMath::Pow(LerpValue, 1.f / BlendExp));
-			break;
-		case EECFBlendFunc::ECFBlend_EaseInOut:
-			CurrentValue = FMath::InterpEaseInOut(StartValue, StopValue, LerpValue, BlendExp);
-			break;
+			TickFunc(MyTimeline.CurrentValue, MyTimeline.CurrentTime);
 		}
 
-		TickFunc(CurrentValue, CurrentTime);
-
-		if (LerpValue >= 1.f)
+		if (bFinished)
 		{
 			Complete(false);
 			MarkAsFinished();
 		}
 	}
 
+	void RemoveTickFunc() override
+	{
+		TickFunc = nullptr;
+	}
+
 	void Complete(bool bStopped) override
 	{
 		if (CallbackFunc)
 		{
-			CallbackFunc(CurrentValue, CurrentTime, bStopped);
+			CallbackFunc(MyTimeline.CurrentValue, MyTimeline.CurrentTime, bStopped);
 		}
 	}
 };
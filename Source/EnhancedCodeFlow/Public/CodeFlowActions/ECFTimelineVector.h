@@ -3,6 +3,7 @@
 #pragma once
 
 #include "ECFActionBase.h"
+#include "ECFTimelineCore.h"
 #include "ECFTypes.h"
 #include "ECFTimelineVector.generated.h"
 
@@ -18,33 +19,18 @@ class ENHANCEDCODEFLOW_API UECFTimelineVector : public UECFActionBase
 protected:
 
 	TUniqueFunction<void(FVector, float)> TickFunc;
-	TUniqueFunction<void(FVector, float, bool)> CallbackFunc;
-	TUniqueFunction<void(FVector, float)> CallbackFunc_NoStopped;
-	FVector StartValue;
-	FVector StopValue;
-	float Time;
-	EECFBlendFunc BlendFunc;
-	float BlendExp;
+	TECFCallback<void(FVector, float, bool)> CallbackFunc;
+	TECFTimelineCore<FVector> MyTimeline;
 
-	float CurrentTime;
-	FVector CurrentValue;
-
-	bool Setup(FVector InStartValue, FVector InStopValue, float InTime, TUniqueFunction<void(FVector, float)>&& InTickFunc, TUniqueFunction<void(FVector, float, bool)>&& InCallbackFunc, EECFBlendFunc InBlendFunc, float InBlendExp)
+	template<typename FuncType>
+	bool Setup(FVector InStartValue, FVector InStopValue, float InTime, TUniqueFunction<void(FVector, float)>&& InTickFunc, FuncType&& InCallbackFunc, EECFBlendFunc InBlendFunc, float InBlendExp)
 	{
-		StartValue = InStartValue;
-		StopValue = InStopValue;
-		Time = InTime;
-
 		TickFunc = MoveTemp(InTickFunc);
-		CallbackFunc = MoveTemp(InCallbackFunc);
-
-		BlendFunc = InBlendFunc;
-		BlendExp = InBlendExp;
+		CallbackFunc = Forward<FuncType>(InCallbackFunc);
 
-		if (TickFunc && Time > 0 && BlendExp != 0 && StartValue != StopValue)
+		if (MyTimeline.Setup(InStartValue, InStopValue, InTime, InBlendFunc, InBlendExp) && TickFunc)
 		{
-			SetMaxActionTime(Time);
-			CurrentTime = 0.f;
+			SetMaxActionTime(InTime);
 			return true;
 		}
 		else
@@ -54,60 +40,35 @@ protected:
 		}
 	}
 
-	bool Setup(FVector InStartValue, FVector InStopValue, float InTime, TUniqueFunction<void(FVector, float)>&& InTickFunc, TUniqueFunction<void(FVector, float)>&& InCallbackFunc, EECFBlendFunc InBlendFunc, float InBlendExp)
-	{
-		CallbackFunc_NoStopped = MoveTemp(InCallbackFunc);
-		return Setup(InStartValue, InStopValue, InTime, MoveTemp(InTickFunc), [this](FVector FwdValue, float FwdTime, bool bStopped)
-		{
-			if (CallbackFunc_NoStopped)
-			{
-				CallbackFunc_NoStopped(FwdValue, FwdTime);
-			}
-		}, InBlendFunc, InBlendExp);
-	}
-
 	void Tick(float DeltaTime) override
 	{
 #if STATS
 		DECLARE_SCOPE_CYCLE_COUNTER(TEXT("Timeline Vector - Tick"), STAT_ECFDETAILS_TIMELINEVECTOR, STATGROUP_ECFDETAILS);
 #endif
-		CurrentTime = FMath::Clamp(CurrentTime + DeltaTime, 0.f, Time);
-
-		const float LerpValue = CurrentTime / Time;
+		const bool bFinished = MyTimeline.Tick(DeltaTime);
 
-		switch (BlendFunc)
+		if (TickFunc)
 		{
-		case EECFBlendFunc::ECFBlend_Linear:
-			CurrentValue = FMath::Lerp(StartValue, StopValue, LerpValue);
-			break;
-		case EECFBlendFunc::ECFBlend_Cubic:
-			CurrentValue = FMath::CubicInterp(StartValue, FVector::ZeroVector, StopValue, FVector::ZeroVector, LerpValue);
-			break;
-		case EECFBlendFunc::ECFBlend_EaseIn:
-			CurrentValue = FMath::Lerp(StartValue, StopValue, FMath::Pow(LerpValue, BlendExp));
-			break;
-		case EECFBlendFunc::ECFBlend_EaseOut:
-			CurrentValue = FMath::Lerp(StartValue, StopValue, FMath::Pow(LerpValue, 1.f / BlendExp));
-			break;
-		case EECFBlendFunc::ECFBlend_EaseInOut:
-			CurrentValue = FMath::InterpEaseInOut(StartValue, StopValue, LerpValue, BlendExp);
-			break;
+			TickFunc(MyTimeline.CurrentValue, MyTimeline.CurrentTime);
 		}
 
-		TickFunc(CurrentValue, CurrentTime);
-
-		if (LerpValue >= 1.f)
+		if (bFinished)
 		{
 			Complete(false);
 			MarkAsFinished();
 		}
 	}
 
+	void RemoveTickFunc() override
+	{
+		TickFunc = nullptr;
+	}
+
 	void Complete(bool bStopped) override
 	{
 		if (CallbackFunc)
 		{
-			CallbackFunc(CurrentValue, CurrentTime, bStopped);
+			CallbackFunc(MyTimeline.CurrentValue, MyTimeline.CurrentTime, bStopped);
 		}
 	}
 };
@@ -0,0 +1,63 @@
+// Copyright (c) 2024 Damian Nowakowski. All rights reserved.
+
+#pragma once
+
+#include "ECFActionBase.h"
+#include "ECFTimelineCore.h"
+#include "ECFTypes.h"
+#include "ECFTypedTimeline.generated.h"
+
+ECF_PRAGMA_DISABLE_OPTIMIZATION
+
+UCLASS()
+class ENHANCEDCODEFLOW_API UECFTypedTimeline : public UECFActionBase
+{
+	GENERATED_BODY()
+
+	friend class UECFSubsystem;
+
+protected:
+
+	TUniquePtr<FECFTypedTimelineBase> MyTimeline;
+
+	bool Setup(TUniquePtr<FECFTypedTimelineBase>&& InTimeline)
+	{
+		MyTimeline = MoveTemp(InTimeline);
+
+		if (MyTimeline.IsValid() && (MyTimeline->CanBlendValues() == false))
+		{
+			ensureMsgf(false, TEXT("ECF - Typed Timeline failed to start. StartValue and StopValue can't be blended with each other. Are you sure arrays have the same size?"));
+			return false;
+		}
+
+		if (MyTimeline.IsValid() && MyTimeline->IsSetupValid())
+		{
+			SetMaxActionTime(MyTimeline->GetTime());
+			return true;
+		}
+		else
+		{
+			ensureMsgf(false, TEXT("ECF - Typed Timeline failed to start. Are you sure the Ticking time is greater than 0 and Ticking Function are set properly? /n Remember, that BlendExp must be different than zero and StartValue and StopValue must not be the same!"));
+			return false;
+		}
+	}
+
+	void Tick(float DeltaTime) override
+	{
+#if STATS
+		DECLARE_SCOPE_CYCLE_COUNTER(TEXT("Typed Timeline - Tick"), STAT_ECFDETAILS_TYPEDTIMELINE, STATGROUP_ECFDETAILS);
+#endif
+		if (MyTimeline->Tick(DeltaTime))
+		{
+			Complete(false);
+			MarkAsFinished();
+		}
+	}
+
+	void Complete(bool bStopped) override
+	{
+		MyTimeline->Complete(bStopped);
+	}
+};
+
+ECF_PRAGMA_ENABLE_OPTIMIZATION
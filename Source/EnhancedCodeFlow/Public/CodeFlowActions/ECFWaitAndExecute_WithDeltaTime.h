@@ -17,18 +17,17 @@ class ENHANCEDCODEFLOW_API UECFWaitAndExecute_WithDeltaTime : public UECFActionB
 protected:
 
 	TUniqueFunction<bool(float)> Predicate;
-	TUniqueFunction<void(bool, bool)> Func;
-	TUniqueFunction<void(bool)> Func_NoStopped;
-	TUniqueFunction<void()> Func_NoTimeOut_NoStopped;
+	TECFCallback<void(bool, bool)> Func;
 
 	float TimeOut = 0.f;
 	bool bWithTimeOut = false;
 	bool bTimedOut = false;
 
-	bool Setup(TUniqueFunction<bool(float)>&& InPredicate, TUniqueFunction<void(bool, bool)>&& InFunc, float InTimeOut)
+	template<typename FuncType>
+	bool Setup(TUniqueFunction<bool(float)>&& InPredicate, FuncType&& InFunc, float InTimeOut)
 	{
 		Predicate = MoveTemp(InPredicate);
-		Func = MoveTemp(InFunc);
+		Func = Forward<FuncType>(InFunc);
 
 		if (Predicate && Func)
 		{
@@ -58,40 +57,6 @@ protected:
 		}
 	}
 
-	bool Setup(TUniqueFunction<bool(float)>&& InPredicate, TUniqueFunction<void(bool)>&& InFunc, float InTimeOut)
-	{
-		Func_NoStopped = MoveTemp(InFunc);
-		if (Func_NoStopped)
-		{
-			return Setup(MoveTemp(InPredicate), [this](bool bTimeOut, bool bStopped)
-			{
-				Func_NoStopped(bTimeOut);
-			}, InTimeOut);
-		}
-		else
-		{
-			ensureMsgf(false, TEXT("ECF - Wait and Execute failed to start. Are you sure the Function is set properly?"));
-			return false;
-		}
-	}
-
-	bool Setup(TUniqueFunction<bool(float)>&& InPredicate, TUniqueFunction<void()>&& InFunc, float InTimeOut)
-	{
-		Func_NoTimeOut_NoStopped = MoveTemp(InFunc);
-		if (Func_NoTimeOut_NoStopped)
-		{
-			return Setup(MoveTemp(InPredicate), [this](bool bTimeOut, bool bStopped)
-			{
-				Func_NoTimeOut_NoStopped();
-			}, InTimeOut);
-		}
-		else
-		{
-			ensureMsgf(false, TEXT("ECF - Wait and Execute failed to start. Are you sure the Function is set properly?"));
-			return false;
-		}
-	}
-
 	void Tick(float DeltaTime) override 
 	{
 #if STATS
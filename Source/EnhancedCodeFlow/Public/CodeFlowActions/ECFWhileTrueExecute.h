@@ -18,19 +18,18 @@ protected:
 
 	TUniqueFunction<bool()> Predicate;
 	TUniqueFunction<void(float)> TickFunc;
-	TUniqueFunction<void(bool, bool)> CompleteFunc;
-	TUniqueFunction<void(bool)> CompleteFunc_NoStopped;
-	TUniqueFunction<void()> CompleteFunc_NoTimeOut_NoStopped;
+	TECFCallback<void(bool, bool)> CompleteFunc;
 
 	float TimeOut = 0.f;
 	bool bWithTimeOut = false;
 	bool bTimedOut = false;
 
-	bool Setup(TUniqueFunction<bool()>&& InPredicate, TUniqueFunction<void(float)>&& InTickFunc, TUniqueFunction<void(bool, bool)>&& InCompleteFunc, float InTimeOut)
+	template<typename FuncType>
+	bool Setup(TUniqueFunction<bool()>&& InPredicate, TUniqueFunction<void(float)>&& InTickFunc, FuncType&& InCompleteFunc, float InTimeOut)
 	{
 		Predicate = MoveTemp(InPredicate);
 		TickFunc = MoveTemp(InTickFunc);
-		CompleteFunc = MoveTemp(InCompleteFunc);
+		CompleteFunc = Forward<FuncType>(InCompleteFunc);
 
 		if (Predicate && TickFunc)
 		{
@@ -63,30 +62,6 @@ protected:
 		}
 	}
 
-	bool Setup(TUniqueFunction<bool()>&& InPredicate, TUniqueFunction<void(float)>&& InTickFunc, TUniqueFunction<void(bool)>&& InCompleteFunc, float InTimeOut)
-	{
-		CompleteFunc_NoStopped = MoveTemp(InCompleteFunc);
-		return Setup(MoveTemp(InPredicate), MoveTemp(InTickFunc), [this](bool bTimeOut, bool bStopped)
-		{
-			if (CompleteFunc_NoStopped)
-			{
-				CompleteFunc_NoStopped(bTimeOut);
-			}
-		}, InTimeOut);
-	}
-
-	bool Setup(TUniqueFunction<bool()>&& InPredicate, TUniqueFunction<void(float)>&& InTickFunc, TUniqueFunction<void()>&& InCompleteFunc, float InTimeOut)
-	{
-		CompleteFunc_NoTimeOut_NoStopped = MoveTemp(InCompleteFunc);
-		return Setup(MoveTemp(InPredicate), MoveTemp(InTickFunc), [this](bool bTimeOut, bool bStopped)
-		{
-			if (CompleteFunc_NoTimeOut_NoStopped)
-			{
-				CompleteFunc_NoTimeOut_NoStopped();
-			}
-		}, InTimeOut);
-	}
-
 	void Tick(float DeltaTime) override 
 	{
 #if STATS
@@ -2,30 +2,173 @@
 
 #pragma once
 
+#include "CoreMinimal.h"
+#include "ECFHandle.h"
+
+struct FECFCoroutinePromiseBase;
+
+// Notified when the frame of a coroutine controlled by ECF is destroyed, so nothing will try to resume it anymore.
+class FECFCoroutineObserver
+{
+
+public:
+
+	virtual void OnCoroutineDestroyed(FECFCoroutinePromiseBase& Promise) = 0;
+
+protected:
+
+	virtual ~FECFCoroutineObserver() {}
+};
+
+// Coroutine being launched by FFlow::StartCoroutine. It is taken by the first ECF coroutine created during the launch.
+struct ENHANCEDCODEFLOW_API FECFCoroutineLaunch
+{
+	FECFCoroutineObserver* Observer = nullptr;
+	FECFHandle HandleId;
+	bool bHasStarted = false;
+
+	// Launch in progress on this thread.
+	static FECFCoroutineLaunch*& Current();
+};
+
+/**
+ * Time budget of a time-sliced loop running in a coroutine:
+ *
+ *	FECFTimeSlice Slice(2.f);
+ *	for (AActor* Actor : Actors) { UpdateVisibility(Actor); if (Slice.ShouldYield()) co_yield FFlow::YieldCoroutine(this); }
+ *
+ * The clock is read once per chunk of iterations. The chunk size adapts to the measured cost of an iteration,
+ * so cheap iterations don't pay for reading the time and expensive ones don't overrun the budget much.
+ */
+class ENHANCEDCODEFLOW_API FECFTimeSlice
+{
+
+public:
+
+	explicit FECFTimeSlice(float InBudgetMs);
+
+	// Call after every iteration. Returns true when the budget is spent and the coroutine should yield.
+	// The next call starts a new slice.
+	bool ShouldYield();
+
+	// Returns the current amount of iterations between time checks.
+	int32 GetChunkSize() const { return ChunkSize; }
+
+private:
+
+	double BudgetSeconds = 0.0;
+	double SliceStartTime = 0.0;
+	int32 SliceIterations = 0;
+	int32 ChunkSize = 1;
+	int32 SliceChunkSize = 1;
+	int32 ChunkIterationsLeft = 1;
+	bool bIsSliceStarted = false;
+};
+
 #ifdef __cpp_impl_coroutine
 
 #include <coroutine>
+#include "ECFCoroutineAllocator.h"
 
 /**
  * Defining coroutine handlers and promises in order to get coroutines work.
  */
 
+// State shared by promises of every ECF coroutine type, so actions can control them in the same way.
+struct FECFCoroutinePromiseBase
+{
+	// Coroutine frames are allocated from the ECF frame pool.
+	static void* operator new(std::size_t Size) { return FECFCoroutineAllocator::Allocate(Size); }
+	static void operator delete(void* Ptr) { FECFCoroutineAllocator::Free(Ptr); }
+
+	~FECFCoroutinePromiseBase()
+	{
+		// Let the subsystem forget the action or timer which would resume this coroutine and the launched coroutine's handle.
+		if (Observer && (bIsSuspended || TrackedHandleId.IsValid()))
+		{
+			checkf(IsInGameThread(), TEXT("ECF Coroutines started with StartCoroutine must be resumed on the Game Thread before they end!"));
+			Observer->OnCoroutineDestroyed(*this);
+		}
+	}
+
+	bool bHasFinished = false;
+
+	// Indicates if the coroutine is suspended by an ECF action or timer.
+	bool bIsSuspended = false;
+
+	// Handle of the coroutine launched with FFlow::StartCoroutine.
+	FECFHandle TrackedHandleId;
+
+	// Subsystem which suspended or launched this coroutine.
+	FECFCoroutineObserver* Observer = nullptr;
+
+	// Indicates if the coroutine has been moved to a worker thread by ResumeOnBackground. Used only on the Game Thread.
+	bool bIsOnBackground = false;
+
+	// Indicates if the coroutine has been stopped while running on a worker thread. It will be destroyed when it's back on the Game Thread.
+	bool bIsStopRequested = false;
+
+	// Owner of the coroutine running on a worker thread. If it's gone, the coroutine won't be resumed on the Game Thread.
+	TWeakObjectPtr<const UObject> BackgroundOwner;
+
+	// co_yield of an ECF awaiter suspends the coroutine the same way co_await does, e.g. co_yield FFlow::YieldCoroutine(this).
+	template<typename TAwaiter>
+	TAwaiter&& yield_value(TAwaiter&& Awaiter) { return Forward<TAwaiter>(Awaiter); }
+};
+
+// Handle to any ECF coroutine (FECFCoroutine or TECFTask) used by coroutine actions.
+struct FECFCoroutineHandle
+{
+	FECFCoroutineHandle() = default;
+
+	template<typename TPromise>
+	FECFCoroutineHandle(std::coroutine_handle<TPromise> InHandle)
+		: Handle(InHandle)
+		, Promise(&InHandle.promise())
+	{}
+
+	void resume() const
+	{
+		Promise->bIsSuspended = false;
+		Handle.resume();
+	}
+
+	void destroy() const { Handle.destroy(); }
+	FECFCoroutinePromiseBase& promise() const { return *Promise; }
+	bool IsValid() const { return Promise != nullptr; }
+
+private:
+
+	std::coroutine_handle<> Handle;
+	FECFCoroutinePromiseBase* Promise = nullptr;
+};
+
 struct FECFCoroutinePromise;
-using FECFCoroutineHandle = std::coroutine_handle<FECFCoroutinePromise>;
 
-struct FECFCoroutine : FECFCoroutineHandle
+struct FECFCoroutine : std::coroutine_handle<FECFCoroutinePromise>
 {
 	using promise_type = ::FECFCoroutinePromise;
 };
 
-struct FECFCoroutinePromise
+struct FECFCoroutinePromise : FECFCoroutinePromiseBase
 {
+	FECFCoroutinePromise()
+	{
+		FECFCoroutineLaunch*& Launch = FECFCoroutineLaunch::Current();
+		if (Launch)
+		{
+			Observer = Launch->Observer;
+			TrackedHandleId = Launch->HandleId;
+			Launch->bHasStarted = true;
+			Launch = nullptr;
+		}
+	}
+
 	FECFCoroutine get_return_object() { return { FECFCoroutine::from_promise(*this) }; }
 	std::suspend_never initial_suspend() noexcept { return {}; }
 	std::suspend_never final_suspend() noexcept { return {}; }
 	void return_void() { bHasFinished = true; }
 	void unhandled_exception() {}
-	bool bHasFinished = false;
 };
 
 #else
@@ -36,15 +179,23 @@ struct FECFCoroutinePromise
 
 using FECFCoroutine = void;
 
-struct FECFCoroutinePromise
+struct FECFCoroutinePromiseBase
 {
 	bool bHasFinished = false;
+	bool bIsSuspended = false;
+	FECFHandle TrackedHandleId;
+	FECFCoroutineObserver* Observer = nullptr;
+	bool bIsOnBackground = false;
+	bool bIsStopRequested = false;
 };
 
+using FECFCoroutinePromise = FECFCoroutinePromiseBase;
+
 struct FECFCoroutineHandle 
 {
 	void resume() {}
 	void destroy() {}
+	bool IsValid() const { return false; }
 
 	FECFCoroutinePromise CoroPromise;
 	FECFCoroutinePromise& promise() { return CoroPromise; }
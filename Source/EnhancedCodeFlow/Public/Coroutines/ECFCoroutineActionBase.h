@@ -21,15 +21,43 @@ protected:
 	// Coroutine handle used to control the coroutine inside the Action.
 	FECFCoroutineHandle CoroutineHandle;
 
-	// Flag indicating if the coroutine handle has been set.
+	// Flag indicating if the coroutine handle has been set and the coroutine still waits for this action.
 	bool bHasCoroutineHandle = false;
 
+	// Resumes the coroutine. It can be done only once, because the coroutine can end and destroy it's frame.
+	void ResumeCoroutine()
+	{
+		if (bHasCoroutineHandle)
+		{
+			bHasCoroutineHandle = false;
+			CoroutineHandle.resume();
+		}
+	}
+
+	void ActionRemoved() override
+	{
+		// The owner is gone, so destroy the coroutine right away, instead of waiting for the garbage collector.
+		// Otherwise the coroutine has been stopped and it stays suspended.
+		if (bHasCoroutineHandle)
+		{
+			bHasCoroutineHandle = false;
+			CoroutineHandle.promise().bIsSuspended = false;
+			if ((HasValidOwner() == false) && (CoroutineHandle.promise().bHasFinished == false))
+			{
+				CoroutineHandle.promise().bHasFinished = true;
+				CoroutineHandle.destroy();
+			}
+		}
+	}
+
 	void BeginDestroy() override
 	{
 		// Handling a case when the owner has beed destroyed before the coroutine has been fully finished.
 		// In such case the handle must be explicitly destroyed.
 		if (bHasCoroutineHandle && (HasValidOwner() == false) && (CoroutineHandle.promise().bHasFinished == false))
 		{
+			bHasCoroutineHandle = false;
+			CoroutineHandle.promise().bIsSuspended = false;
 			CoroutineHandle.promise().bHasFinished = true;
 			CoroutineHandle.destroy();
 		}
@@ -45,6 +73,32 @@ private:
 		CoroutineHandle = InCoroutineHandle;
 		bHasCoroutineHandle = true;
 	}
+
+	// Called by the subsystem when the coroutine waiting for this action has been destroyed.
+	void ForgetCoroutine(const FECFCoroutinePromiseBase& Promise)
+	{
+		if (bHasCoroutineHandle && (&CoroutineHandle.promise() == &Promise))
+		{
+			bHasCoroutineHandle = false;
+			MarkAsFinished();
+		}
+	}
+
+	// Destroys the coroutine waiting for this action and stops the action.
+	void DestroyCoroutine()
+	{
+		if (bHasCoroutineHandle)
+		{
+			bHasCoroutineHandle = false;
+			CoroutineHandle.promise().bIsSuspended = false;
+			if (CoroutineHandle.promise().bHasFinished == false)
+			{
+				CoroutineHandle.promise().bHasFinished = true;
+				CoroutineHandle.destroy();
+			}
+		}
+		MarkAsFinished();
+	}
 };
 
 ECF_PRAGMA_ENABLE_OPTIMIZATION
\ No newline at end of file
@@ -0,0 +1,41 @@
+// Copyright (c) 2024 Damian Nowakowski. All rights reserved.
+
+/**
+ * Allocator of ECF coroutine frames.
+ * Frames are taken from pooled memory chunks split into slots of a few size classes, so short-living coroutines
+ * don't allocate from the global allocator every time they start. Frames bigger than the biggest size class
+ * are allocated from the global allocator.
+ * The pool is shared by every subsystem, because frames can live longer than the world which started them.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+ECF_PRAGMA_DISABLE_OPTIMIZATION
+
+class ENHANCEDCODEFLOW_API FECFCoroutineAllocator
+{
+
+public:
+
+	// Checks if the pool is enabled (controlled by the ECF.CoroutineFramePool console variable).
+	static bool IsEnabled();
+
+	// Allocates memory for a coroutine frame of the given size.
+	static void* Allocate(SIZE_T Size);
+
+	// Frees memory of a coroutine frame allocated with Allocate.
+	static void Free(void* Ptr);
+
+	// Returns the amount of bytes used by coroutine frames which are currently alive.
+	static int64 GetBytesInUse();
+
+	// Returns the amount of bytes reserved by the pool.
+	static int64 GetBytesReserved();
+
+	// Frees pooled memory chunks if no frame uses them anymore.
+	static void ReleaseUnusedMemory();
+};
+
+ECF_PRAGMA_ENABLE_OPTIMIZATION
@@ -4,6 +4,10 @@
 
 #include "ECFCoroutine.h"
 #include "ECFSubsystem.h"
+#include "ECFAsyncResult.h"
+#include "ECFAsyncExecutor.h"
+#include "ECFWaitConditions.h"
+#include "ECFDelegateBinding.h"
 #include "ECFTypes.h"
 
 class ENHANCEDCODEFLOW_API FECFCoroutineAwaiter
@@ -26,6 +30,24 @@ protected:
 		}
 	}
 
+	// Helper function for adding timers of suspended coroutines to the ECF subsystem's scheduler.
+	// Falls back to the coroutine action of the given type if the scheduler can't handle it.
+	template<typename T, typename TValue>
+	void AddCoroutineTimer(const UObject* InOwner, FECFCoroutineHandle InCoroutineHandle, const FECFActionSettings& InSettings, EECFCoroutineTimerType InType, TValue InValue)
+	{
+		if (UECFSubsystem* ECF = UECFSubsystem::Get(InOwner))
+		{
+			if (ECF->CoroutineScheduler.AddTimer(InOwner, InCoroutineHandle, InSettings, InType, static_cast<float>(InValue)))
+			{
+				ECF->MarkCoroutineSuspended(InCoroutineHandle);
+			}
+			else
+			{
+				ECF->AddCoroutineAction<T>(InOwner, InCoroutineHandle, InSettings, InValue);
+			}
+		}
+	}
+
 	// Storing owner to pass it to the ECF subsystem later.
 	const UObject* Owner;
 
@@ -44,6 +66,9 @@ public:
 	
 	// Called when the suspension begins
 	void await_suspend(FECFCoroutineHandle CoroHandle);
+
+	// Moves the awaited condition out, so it can be driven by the When All/Any awaiter instead.
+	TUniquePtr<FECFWaitCondition> MakeCondition();
 	
 private:
 
@@ -63,12 +88,28 @@ public:
 	// Called when the suspension begins
 	void await_suspend(FECFCoroutineHandle CoroHandle);
 
+	// Moves the awaited condition out, so it can be driven by the When All/Any awaiter instead.
+	TUniquePtr<FECFWaitCondition> MakeCondition();
+
 private:
 
 	// Storing values in order to use them when await_suspend is called
 	int32 Ticks = 0;
 };
 
+/*^^^ Yield Coroutine Awaiter ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^*/
+
+class ENHANCEDCODEFLOW_API FECFCoroutineAwaiter_Yield : public FECFCoroutineAwaiter
+{
+public:
+
+	// C-tor
+	FECFCoroutineAwaiter_Yield(const UObject* InOwner);
+
+	// Called when the suspension begins
+	void await_suspend(FECFCoroutineHandle CoroHandle);
+};
+
 /*^^^ Wait Until Coroutine Awaiter ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^*/
 
 class ENHANCEDCODEFLOW_API FECFCoroutineAwaiter_WaitUntil : public FECFCoroutineAwaiter
@@ -81,6 +122,9 @@ public:
 	// Called when the suspension begins
 	void await_suspend(FECFCoroutineHandle CoroHandle);
 
+	// Moves the awaited condition out, so it can be driven by the When All/Any awaiter instead.
+	TUniquePtr<FECFWaitCondition> MakeCondition();
+
 private:
 
 	// Storing values in order to use them when await_suspend is called
@@ -95,16 +139,149 @@ class ENHANCEDCODEFLOW_API FECFCoroutineAwaiter_RunAsyncAndWait : public FECFCor
 public:
 
 	// C-tor
-	FECFCoroutineAwaiter_RunAsyncAndWait(const UObject* InOwner, const FECFActionSettings& InSettings, TUniqueFunction<void()>&& InAsyncTaskFunc, float InTimeOut, EECFAsyncPrio InThreadPriority);
+	FECFCoroutineAwaiter_RunAsyncAndWait(const UObject* InOwner, const FECFActionSettings& InSettings, TUniqueFunction<void(const FECFCancellationToken&)>&& InAsyncTaskFunc, float InTimeOut, const FECFAsyncExecutor& InExecutor);
 
 	// Called when the suspension begins
 	void await_suspend(FECFCoroutineHandle CoroHandle);
 
+	// Moves the awaited condition out, so it can be driven by the When All/Any awaiter instead.
+	TUniquePtr<FECFWaitCondition> MakeCondition();
+
 private:
 
 	// Storing values in order to use them when await_suspend is called
-	TUniqueFunction<void()> AsyncTaskFunction;
+	TUniqueFunction<void(const FECFCancellationToken&)> AsyncTaskFunction;
 	float TimeOut = 0.f;
-	EECFAsyncPrio ThreadPriority = EECFAsyncPrio::Normal;
+	FECFAsyncExecutor Executor;
+};
+
+/*^^^ Run Async And Wait With Result Coroutine Awaiter ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^*/
+
+template<typename TResult>
+class TECFCoroutineAwaiter_RunAsyncAndWait : public FECFCoroutineAwaiter_RunAsyncAndWait
+{
+public:
+
+	// C-tor
+	TECFCoroutineAwaiter_RunAsyncAndWait(const UObject* InOwner, const FECFActionSettings& InSettings, const TSharedRef<TECFAsyncResult<TResult>, ESPMode::ThreadSafe>& InAsyncResult, float InTimeOut, const FECFAsyncExecutor& InExecutor)
+		: FECFCoroutineAwaiter_RunAsyncAndWait(InOwner, InSettings, [InAsyncResult](const FECFCancellationToken& Token) { InAsyncResult->Run(Token); }, InTimeOut, InExecutor)
+		, AsyncResult(InAsyncResult)
+	{}
+
+	// Returns the result of the async task. It is not set if the task has timed out.
+	TOptional<TResult> await_resume()
+	{
+		return AsyncResult->ConsumeResult();
+	}
+
+private:
+
+	TSharedRef<TECFAsyncResult<TResult>, ESPMode::ThreadSafe> AsyncResult;
+};
+
+/*^^^ Resume On Background Coroutine Awaiter ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^*/
+
+class ENHANCEDCODEFLOW_API FECFCoroutineAwaiter_ResumeOnBackground : public FECFCoroutineAwaiter
+{
+public:
+
+	// C-tor
+	FECFCoroutineAwaiter_ResumeOnBackground(const UObject* InOwner, const FECFAsyncExecutor& InExecutor);
+
+	// The coroutine already running on a worker thread is not suspended.
+	bool await_ready();
+
+#ifdef __cpp_impl_coroutine
+	// Called when the suspension begins. Only FECFCoroutine can change threads, as tasks are resumed by coroutines awaiting them.
+	void await_suspend(std::coroutine_handle<FECFCoroutinePromise> CoroHandle)
+	{
+		LaunchCoroutine(CoroHandle);
+	}
+#endif
+
+private:
+
+	// Resumes the coroutine on the executor.
+	void LaunchCoroutine(FECFCoroutineHandle CoroHandle);
+
+	// Storing values in order to use them when await_suspend is called
+	FECFAsyncExecutor Executor;
 };
 
+/*^^^ Resume On Game Thread Coroutine Awaiter ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^*/
+
+class ENHANCEDCODEFLOW_API FECFCoroutineAwaiter_ResumeOnGameThread : public FECFCoroutineAwaiter
+{
+public:
+
+	// C-tor
+	FECFCoroutineAwaiter_ResumeOnGameThread();
+
+	// The coroutine already running on the Game Thread is not suspended.
+	bool await_ready();
+
+#ifdef __cpp_impl_coroutine
+	// Called when the suspension begins. Only FECFCoroutine can change threads, as tasks are resumed by coroutines awaiting them.
+	void await_suspend(std::coroutine_handle<FECFCoroutinePromise> CoroHandle)
+	{
+		ResumeCoroutine(CoroHandle);
+	}
+#endif
+
+private:
+
+	// Resumes the coroutine on the Game Thread.
+	void ResumeCoroutine(FECFCoroutineHandle CoroHandle);
+};
+
+/*^^^ Wait For Delegate Coroutine Awaiter ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^*/
+
+class ENHANCEDCODEFLOW_API FECFCoroutineAwaiter_WaitForDelegate : public FECFCoroutineAwaiter
+{
+public:
+
+	// C-tor
+	FECFCoroutineAwaiter_WaitForDelegate(const UObject* InOwner, const FECFActionSettings& InSettings, TUniquePtr<FECFDelegateBinding>&& InBinding, float InTimeOut);
+
+	// Called when the suspension begins
+	void await_suspend(FECFCoroutineHandle CoroHandle);
+
+	// Returns true if the coroutine has been resumed because of the timeout, not because the delegate has fired.
+	bool await_resume()
+	{
+		return *bTimedOut;
+	}
+
+private:
+
+	// Storing values in order to use them when await_suspend is called
+	TUniquePtr<FECFDelegateBinding> Binding;
+	float TimeOut = 0.f;
+	TSharedPtr<bool> bTimedOut;
+};
+
+/*^^^ When All/Any Coroutine Awaiter ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^*/
+
+class ENHANCEDCODEFLOW_API FECFCoroutineAwaiter_WhenAllAny : public FECFCoroutineAwaiter
+{
+public:
+
+	// C-tor
+	FECFCoroutineAwaiter_WhenAllAny(const UObject* InOwner, const FECFActionSettings& InSettings, TArray<TUniquePtr<FECFWaitCondition>>&& InConditions, bool bInWaitForAll);
+
+	// Called when the suspension begins
+	void await_suspend(FECFCoroutineHandle CoroHandle);
+
+	// Returns the index of the awaiter which has resumed the coroutine in When Any. INDEX_NONE if the action has been stopped.
+	int32 await_resume()
+	{
+		return *WinnerIndex;
+	}
+
+private:
+
+	// Storing values in order to use them when await_suspend is called
+	TArray<TUniquePtr<FECFWaitCondition>> Conditions;
+	bool bWaitForAll = false;
+	TSharedPtr<int32> WinnerIndex;
+};
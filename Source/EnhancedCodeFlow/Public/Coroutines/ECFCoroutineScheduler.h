@@ -0,0 +1,101 @@
+// Copyright (c) 2024 Damian Nowakowski. All rights reserved.
+
+/**
+ * Scheduler of coroutines suspended by Wait Seconds and Wait Ticks awaiters.
+ * Instead of creating a coroutine action object for every suspension, the coroutine handle, it's owner,
+ * the time (or ticks) left and the settings are stored in a compact timer list, which is ticked by the subsystem.
+ * Settings requiring the full action logic (tick interval, starting paused) still use coroutine actions.
+ * Coroutines which have yielded (co_yield FFlow::YieldCoroutine) are resumed in the next frame, in the order they have yielded,
+ * as long as the yield budget of the frame allows it (controlled by the ECF.CoroutineYieldBudget console variable).
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ECFActionSettings.h"
+#include "ECFCoroutine.h"
+#include "ECFTypes.h"
+
+ECF_PRAGMA_DISABLE_OPTIMIZATION
+
+class UWorld;
+
+enum class EECFCoroutineTimerType : uint8
+{
+	Seconds,
+	Ticks,
+	Yield,
+	Any
+};
+
+class ENHANCEDCODEFLOW_API FECFCoroutineScheduler
+{
+
+public:
+
+	// Checks if the scheduler is enabled (controlled by the ECF.CoroutineScheduler console variable).
+	static bool IsEnabled();
+
+	// Adds the suspended coroutine to the timer list. Returns false if it must be handled by a coroutine action instead.
+	bool AddTimer(const UObject* InOwner, FECFCoroutineHandle InCoroutineHandle, const FECFActionSettings& InSettings, EECFCoroutineTimerType InType, float InValue);
+
+	// Advances all timers and resumes coroutines which timers have ended and coroutines which have yielded.
+	void Tick(UWorld* World, float DeltaTime);
+
+	// Removes timers of the given type assigned to a specific owner (if specified). Resumes their coroutines if bComplete is set.
+	void RemoveTimers(EECFCoroutineTimerType InType, bool bComplete, const UObject* InOwner);
+
+	// Removes the timer of the destroyed coroutine without resuming it.
+	void ForgetCoroutine(const FECFCoroutinePromiseBase& Promise);
+
+	// Destroys coroutines of timers assigned to a specific owner (if specified) and removes these timers.
+	void DestroyCoroutines(const UObject* InOwner);
+
+	// Destroys coroutines of all timers which haven't finished yet and removes these timers.
+	void Reset();
+
+	// Returns the number of timers.
+	int32 Num() const;
+
+private:
+
+	enum class ETimerState : uint8
+	{
+		Running,
+		Ended,
+		Removed
+	};
+
+	struct FTimer
+	{
+		FECFCoroutineHandle CoroutineHandle;
+		TWeakObjectPtr<const UObject> Owner;
+
+		// Seconds or ticks left to resume the coroutine.
+		float Remaining = 0.f;
+		float DelayLeft = 0.f;
+
+		// Frame in which the coroutine has yielded. It will be resumed in any later frame.
+		uint64 YieldFrame = 0;
+
+		EECFCoroutineTimerType Type = EECFCoroutineTimerType::Seconds;
+		ETimerState State = ETimerState::Running;
+		uint8 bIgnorePause : 1;
+		uint8 bIgnoreGlobalTimeDilation : 1;
+	};
+
+	// Resumes coroutines of ended timers. Resumed coroutines can add, remove or destroy other timers,
+	// so timers are only marked as removed here and the list is compacted in the next tick.
+	void ResumeEndedTimers();
+
+	// Resumes coroutines which have yielded in previous frames, until the yield budget of this frame is spent.
+	void ResumeYieldedTimers(bool bIsWorldPaused);
+
+	// Destroys the coroutine of the timer which will not be resumed anymore.
+	static void DestroyCoroutine(FECFCoroutineHandle CoroutineHandle);
+
+	// Active timers.
+	TArray<FTimer> Timers;
+};
+
+ECF_PRAGMA_ENABLE_OPTIMIZATION
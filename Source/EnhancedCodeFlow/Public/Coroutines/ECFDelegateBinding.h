@@ -0,0 +1,91 @@
+// Copyright (c) 2024 Damian Nowakowski. All rights reserved.
+
+/**
+ * Type erased binding to a multicast delegate awaited by the Wait For Delegate coroutine action.
+ * Native multicast delegates are bound with a weak lambda, dynamic multicast delegates are bound to
+ * a UFUNCTION of the listener. The listener function doesn't take any parameters, so it can be bound
+ * to a delegate of any signature - the delegate parameters are ignored.
+ * If the object owning the delegate is given, the binding won't touch the delegate after this object is gone.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include <type_traits>
+
+ECF_PRAGMA_DISABLE_OPTIMIZATION
+
+class FECFDelegateBinding
+{
+
+public:
+
+	virtual ~FECFDelegateBinding() {}
+
+	// Binds the listener to the delegate. ListenerFunctionName is used by dynamic delegates, NativeListener by native ones.
+	virtual void Bind(UObject* ListenerObject, const FName& ListenerFunctionName, TFunction<void()>&& NativeListener) = 0;
+
+	// Unbinds the listener from the delegate.
+	virtual void Unbind() = 0;
+};
+
+template<typename TDelegate>
+class TECFDelegateBinding : public FECFDelegateBinding
+{
+
+public:
+
+	TECFDelegateBinding(TDelegate& InDelegate, const UObject* InDelegateOwner)
+		: Delegate(InDelegate)
+		, DelegateOwner(InDelegateOwner)
+		, bHasDelegateOwner(InDelegateOwner != nullptr)
+	{}
+
+	void Bind(UObject* ListenerObject, const FName& ListenerFunctionName, TFunction<void()>&& NativeListener) override
+	{
+		if constexpr (std::is_base_of_v<FMulticastScriptDelegate, TDelegate>)
+		{
+			ScriptDelegate.BindUFunction(ListenerObject, ListenerFunctionName);
+			Delegate.AddUnique(ScriptDelegate);
+		}
+		else
+		{
+			NativeHandle = Delegate.AddWeakLambda(ListenerObject, [Listener = MoveTemp(NativeListener)](auto&& ...)
+			{
+				Listener();
+			});
+		}
+	}
+
+	void Unbind() override
+	{
+		// The delegate has been destroyed together with it's owner, so there is nothing to remove the listener from.
+		if (bHasDelegateOwner && (DelegateOwner.IsValid() == false))
+		{
+			ScriptDelegate.Unbind();
+			NativeHandle.Reset();
+			return;
+		}
+
+		if constexpr (std::is_base_of_v<FMulticastScriptDelegate, TDelegate>)
+		{
+			Delegate.Remove(ScriptDelegate);
+			ScriptDelegate.Unbind();
+		}
+		else
+		{
+			Delegate.Remove(NativeHandle);
+			NativeHandle.Reset();
+		}
+	}
+
+private:
+
+	TDelegate& Delegate;
+	TWeakObjectPtr<const UObject> DelegateOwner;
+	bool bHasDelegateOwner = false;
+	FDelegateHandle NativeHandle;
+	FScriptDelegate ScriptDelegate;
+};
+
+ECF_PRAGMA_ENABLE_OPTIMIZATION
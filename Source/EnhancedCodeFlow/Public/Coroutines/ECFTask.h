@@ -0,0 +1,176 @@
+// Copyright (c) 2024 Damian Nowakowski. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ECFCoroutine.h"
+
+#ifdef __cpp_impl_coroutine
+
+/**
+ * Coroutine which can return a value with co_return and can be awaited by other ECF coroutines:
+ *
+ *	TECFTask<int32> LoadLevelData() { co_await FFlow::WaitSeconds(this, 1.f); co_return 42; }
+ *	FECFCoroutine Run() { int32 Data = co_await LoadLevelData(); }
+ *
+ * The task starts when it is awaited. When it ends, the awaiting coroutine is resumed right away (symmetric transfer),
+ * without any extra action or frame of latency. If the task is destroyed before it ends (e.g. it's owner has been destroyed),
+ * the awaiting coroutines are destroyed too.
+ */
+
+template<typename T = void>
+class TECFTask;
+
+struct FECFTaskPromiseBase : FECFCoroutinePromiseBase
+{
+	// Resumes the awaiting coroutine when the task ends.
+	struct FFinalAwaiter
+	{
+		bool await_ready() noexcept { return false; }
+		void await_resume() noexcept {}
+
+		template<typename TPromise>
+		std::coroutine_handle<> await_suspend(std::coroutine_handle<TPromise> TaskHandle) noexcept
+		{
+			std::coroutine_handle<> Continuation = TaskHandle.promise().Continuation;
+			return Continuation ? Continuation : std::noop_coroutine();
+		}
+	};
+
+	~FECFTaskPromiseBase()
+	{
+		// The task has been destroyed before it ended, which means nothing will resume coroutines awaiting it.
+		// Destroy them too, so they won't leak.
+		if (TaskOwnerHandle)
+		{
+			*TaskOwnerHandle = nullptr;
+		}
+		if ((bHasReachedEnd == false) && Continuation)
+		{
+			Continuation.destroy();
+		}
+	}
+
+	std::suspend_always initial_suspend() noexcept { return {}; }
+	FFinalAwaiter final_suspend() noexcept
+	{
+		bHasFinished = true;
+		bHasReachedEnd = true;
+		return {};
+	}
+	void unhandled_exception() {}
+
+	// Coroutine awaiting this task.
+	std::coroutine_handle<> Continuation;
+
+	// Handle stored in the task object, cleared when the task is destroyed from outside of it.
+	std::coroutine_handle<>* TaskOwnerHandle = nullptr;
+
+	bool bHasReachedEnd = false;
+};
+
+template<typename T>
+struct TECFTaskPromise : FECFTaskPromiseBase
+{
+	TECFTask<T> get_return_object();
+	void return_value(const T& InValue) { Result.Emplace(InValue); }
+	void return_value(T&& InValue) { Result.Emplace(MoveTemp(InValue)); }
+
+	TOptional<T> Result;
+};
+
+template<>
+struct TECFTaskPromise<void> : FECFTaskPromiseBase
+{
+	TECFTask<void> get_return_object();
+	void return_void() {}
+};
+
+template<typename T>
+class TECFTask
+{
+
+public:
+
+	using promise_type = TECFTaskPromise<T>;
+
+	explicit TECFTask(std::coroutine_handle<promise_type> InHandle)
+		: Handle(InHandle)
+	{
+		InHandle.promise().TaskOwnerHandle = &Handle;
+	}
+
+	TECFTask(TECFTask&& Other)
+		: Handle(Other.Handle)
+	{
+		Other.Handle = nullptr;
+		if (Handle)
+		{
+			GetPromise().TaskOwnerHandle = &Handle;
+		}
+	}
+
+	TECFTask(const TECFTask&) = delete;
+	TECFTask& operator=(const TECFTask&) = delete;
+	TECFTask& operator=(TECFTask&&) = delete;
+
+	~TECFTask()
+	{
+		if (Handle)
+		{
+			// The task object is destroyed together with the coroutine awaiting it, so the task must not destroy it again.
+			GetPromise().TaskOwnerHandle = nullptr;
+			GetPromise().Continuation = nullptr;
+			Handle.destroy();
+		}
+	}
+
+	// Functions required by any coroutine awaiter.
+	bool await_ready() const { return Handle == nullptr; }
+
+	std::coroutine_handle<> await_suspend(std::coroutine_handle<> AwaitingHandle)
+	{
+		// Start the task right away, it will resume the awaiting coroutine when it ends.
+		GetPromise().Continuation = AwaitingHandle;
+		return Handle;
+	}
+
+	T await_resume()
+	{
+		if constexpr (std::is_void_v<T> == false)
+		{
+			return MoveTemp(GetPromise().Result.GetValue());
+		}
+	}
+
+private:
+
+	promise_type& GetPromise() const
+	{
+		return std::coroutine_handle<promise_type>::from_address(Handle.address()).promise();
+	}
+
+	std::coroutine_handle<> Handle;
+};
+
+template<typename T>
+TECFTask<T> TECFTaskPromise<T>::get_return_object()
+{
+	return TECFTask<T>(std::coroutine_handle<TECFTaskPromise<T>>::from_promise(*this));
+}
+
+inline TECFTask<void> TECFTaskPromise<void>::get_return_object()
+{
+	return TECFTask<void>(std::coroutine_handle<TECFTaskPromise<void>>::from_promise(*this));
+}
+
+#else
+
+/**
+ * Create dummy implementation of the task if coroutines are not supported by a compiler.
+ */
+
+template<typename T = void>
+using TECFTask = void;
+
+#endif
@@ -0,0 +1,188 @@
+// Copyright (c) 2024 Damian Nowakowski. All rights reserved.
+
+/**
+ * Conditions checked by WhenAll and WhenAny coroutine awaiters.
+ * They do the same thing as coroutine actions (Wait Seconds, Wait Ticks, Wait Until, Run Async And Wait),
+ * but they are not UObjects, so many of them can be driven by one action.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ECFSubsystem.h"
+#include "ECFCancellationToken.h"
+#include "ECFAsyncExecutor.h"
+#include <atomic>
+
+ECF_PRAGMA_DISABLE_OPTIMIZATION
+
+class ENHANCEDCODEFLOW_API FECFWaitCondition
+{
+
+public:
+
+	virtual ~FECFWaitCondition() {}
+
+	// Called once when the action driving this condition starts. Returns true if the condition is already met.
+	virtual bool Start(UECFSubsystem* ECF, const FECFHandle& InHandleId) { return false; }
+
+	// Returns true when the condition is met.
+	virtual bool Tick(float DeltaTime) = 0;
+
+	// Called when the condition is no longer needed (e.g. other condition won the WhenAny).
+	virtual void Cancel() {}
+
+	// Checks if the condition can only be met by an event, so there is no need to tick it.
+	virtual bool IsWaitingForEvent() const { return false; }
+};
+
+/*^^^ Wait Seconds Condition ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^*/
+
+class FECFWaitCondition_WaitSeconds : public FECFWaitCondition
+{
+
+public:
+
+	FECFWaitCondition_WaitSeconds(float InWaitTime)
+		: WaitTime(InWaitTime)
+	{}
+
+	bool Tick(float DeltaTime) override
+	{
+		CurrentTime += DeltaTime;
+		return CurrentTime > WaitTime;
+	}
+
+private:
+
+	float WaitTime = 0.f;
+	float CurrentTime = 0.f;
+};
+
+/*^^^ Wait Ticks Condition ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^*/
+
+class FECFWaitCondition_WaitTicks : public FECFWaitCondition
+{
+
+public:
+
+	FECFWaitCondition_WaitTicks(int32 InWaitTicks)
+		: WaitTicks(InWaitTicks)
+	{}
+
+	bool Tick(float DeltaTime) override
+	{
+		CurrentTicks++;
+		return CurrentTicks > WaitTicks;
+	}
+
+private:
+
+	int32 WaitTicks = 0;
+	int32 CurrentTicks = 0;
+};
+
+/*^^^ Wait Until Condition ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^*/
+
+class FECFWaitCondition_WaitUntil : public FECFWaitCondition
+{
+
+public:
+
+	FECFWaitCondition_WaitUntil(TUniqueFunction<bool(float)>&& InPredicate, float InTimeOut)
+		: Predicate(MoveTemp(InPredicate))
+		, TimeOut(InTimeOut)
+		, bWithTimeOut(InTimeOut > 0.f)
+	{}
+
+	bool Start(UECFSubsystem* ECF, const FECFHandle& InHandleId) override
+	{
+		return Predicate(0.f);
+	}
+
+	bool Tick(float DeltaTime) override
+	{
+		if (bWithTimeOut)
+		{
+			TimeOut -= DeltaTime;
+			if (TimeOut <= 0.f)
+			{
+				return true;
+			}
+		}
+		return Predicate(DeltaTime);
+	}
+
+private:
+
+	TUniqueFunction<bool(float)> Predicate;
+	float TimeOut = 0.f;
+	bool bWithTimeOut = false;
+};
+
+/*^^^ Run Async And Wait Condition ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^*/
+
+class FECFWaitCondition_RunAsyncAndWait : public FECFWaitCondition
+{
+
+public:
+
+	FECFWaitCondition_RunAsyncAndWait(TUniqueFunction<void(const FECFCancellationToken&)>&& InAsyncTaskFunc, float InTimeOut, const FECFAsyncExecutor& InExecutor)
+		: AsyncTaskFunc(MoveTemp(InAsyncTaskFunc))
+		, Executor(InExecutor)
+		, TimeOut(InTimeOut)
+		, bWithTimeOut(InTimeOut > 0.f)
+		, bIsAsyncTaskDone(MakeShared<std::atomic<bool>, ESPMode::ThreadSafe>(false))
+	{}
+
+	bool Start(UECFSubsystem* ECF, const FECFHandle& InHandleId) override
+	{
+		// The task function is moved to the worker, so it stays valid even if this condition is gone before the task ends.
+		// The driving action is woken up via the subsystem's completion queue.
+		Executor.Launch([TaskFunc = MoveTemp(AsyncTaskFunc), Token = CancellationToken, bDone = bIsAsyncTaskDone, CompletionQueue = ECF->AsyncCompletionQueue, InHandleId]()
+		{
+			if (Token.IsCancelled() == false)
+			{
+				TaskFunc(Token);
+				bDone->store(true, std::memory_order_release);
+				CompletionQueue->Enqueue(InHandleId);
+			}
+		});
+		return false;
+	}
+
+	bool Tick(float DeltaTime) override
+	{
+		if (bWithTimeOut)
+		{
+			TimeOut -= DeltaTime;
+			if (TimeOut <= 0.f)
+			{
+				CancellationToken.Cancel();
+				return true;
+			}
+		}
+		return bIsAsyncTaskDone->load(std::memory_order_acquire);
+	}
+
+	void Cancel() override
+	{
+		CancellationToken.Cancel();
+	}
+
+	bool IsWaitingForEvent() const override
+	{
+		return bWithTimeOut == false;
+	}
+
+private:
+
+	TUniqueFunction<void(const FECFCancellationToken&)> AsyncTaskFunc;
+	FECFAsyncExecutor Executor;
+	FECFCancellationToken CancellationToken;
+	float TimeOut = 0.f;
+	bool bWithTimeOut = false;
+	TSharedRef<std::atomic<bool>, ESPMode::ThreadSafe> bIsAsyncTaskDone;
+};
+
+ECF_PRAGMA_ENABLE_OPTIMIZATION
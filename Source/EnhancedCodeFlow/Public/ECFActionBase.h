@@ -6,7 +6,9 @@
 #include "ECFHandle.h"
 #include "ECFInstanceId.h"
 #include "ECFActionSettings.h"
+#include "ECFPackedActionSettings.h"
 #include "ECFStats.h"
+#include "ECFCallback.h"
 #include "Misc/AssertionMacros.h"
 #include "Engine/World.h"
 #include "GameFramework/WorldSettings.h"
@@ -20,6 +22,7 @@ class ENHANCEDCODEFLOW_API UECFActionBase : public UObject
 	GENERATED_BODY()
 
 	friend class UECFSubsystem;
+	friend class UECFActionBP;
 
 public:
 
@@ -92,6 +95,23 @@ protected:
 	// Function called when this action is instanced and something tried to call it again.
 	virtual void RetriggeredInstancedAction() {}
 
+	// Function called by the subsystem when the async task launched by this action has finished.
+	virtual void AsyncTaskFinished() {}
+
+	// Function called by the subsystem right before this action is removed from it
+	// (because it has finished, has been stopped or it's owner is no longer valid).
+	virtual void ActionRemoved() {}
+
+	// Function called when nothing listens to the ticks of this action (e.g. the tick event of the Blueprint node is not bound).
+	// Actions with tick functions can stop launching them, but they must keep working the same way otherwise.
+	virtual void RemoveTickFunc() {}
+
+	// Action waiting for an event is not ticked by the subsystem until it stops waiting.
+	void SetWaitingForEvent(bool bInIsWaitingForEvent)
+	{
+		bIsWaitingForEvent = bInIsWaitingForEvent;
+	}
+
 	// For any action that should last only the given time - set this function
 	// inside the action's Setup step. 
 	// WARNING! This is only to help ticker run ticks with proper delta times.
@@ -112,8 +132,8 @@ protected:
 	// InstanceId for actions that are instanced
 	FECFInstanceId InstanceId;
 
-	// Settings for this action
-	FECFActionSettings Settings;
+	// Settings for this action, shared with other actions using the same settings.
+	FECFPackedActionSettings Settings;
 
 	// Sets the owner and handle id of this action.
 	void SetAction(const UObject* InOwner, const FECFHandle& InHandleId, const FECFInstanceId& InInstanceId, const FECFActionSettings& InSettings)
@@ -126,11 +146,11 @@ protected:
 		CurrentActionTime = 0.f;
 		AccumulatedTime = 0.f;
 
-		ActionDelayLeft = Settings.FirstDelay;
+		ActionDelayLeft = Settings.GetFirstDelay();
 
 		bFirstTick = true;
 
-		if (Settings.bStartPaused)
+		if (Settings.StartsPaused())
 		{
 			bIsPaused = true;
 		}
@@ -148,7 +168,7 @@ private:
 		}
 
 		// If game is paused and the action does not ignore this pause - ignore tick.
-		if (Settings.bIgnorePause == false)
+		if (Settings.IgnoresPause() == false)
 		{
 			if (UWorld* World = GetWorld())
 			{
@@ -161,7 +181,7 @@ private:
 
 		// If global time dilation is not ignored (by default it is not) apply
 		// this time dilation to the delta time.
-		if (Settings.bIgnoreGlobalTimeDilation == false)
+		if (Settings.IgnoresGlobalTimeDilation() == false)
 		{
 			float TimeDilation = 1.f;
 			if (UWorld* World = GetWorld())
@@ -191,7 +211,7 @@ private:
 			// If not, simply do a tick.
 			// WARNING! This will not stop the action. Ensure that the action has proper logic in tick function
 			// that will stop it when the time has passed.
-			if (Settings.TickInterval > 0.f)
+			if (Settings.GetTickInterval() > 0.f)
 			{
 				AccumulatedTime += DeltaTime;
 				Tick(AccumulatedTime);
@@ -216,12 +236,12 @@ private:
 				// Tick with the given interval, otherwise do a simple tick.
 				// Clear accumulated time (no subtract the interval) as we are interested in ticks 
 				// that happens the exact time after the previous one.
-				if (Settings.TickInterval > 0.f)
+				if (Settings.GetTickInterval() > 0.f)
 				{
 					AccumulatedTime += DeltaTime;
-					if (AccumulatedTime >= Settings.TickInterval)
+					if (AccumulatedTime >= Settings.GetTickInterval())
 					{
-						Tick(Settings.TickInterval);
+						Tick(Settings.GetTickInterval());
 						AccumulatedTime = 0;
 					}
 				}
@@ -243,11 +263,18 @@ private:
 	// Indicates if this action is paused (by the ECF system).
 	bool bIsPaused = false;
 
+	// Indicates if this action waits for an event and should not be ticked.
+	bool bIsWaitingForEvent = false;
+
 	// Timers for this action
 	float CurrentActionTime = 0.f;
 	float ActionDelayLeft = 0.f;
 	float AccumulatedTime = 0.f;
 	float MaxActionTime = 0.f;
+
+	// Size of this action added to the Actions Memory stat when it was created.
+	// Kept, so the same size is removed when it's destroyed, even if the class is no longer valid then.
+	int32 StatMemorySize = 0;
 };
 
 ECF_PRAGMA_ENABLE_OPTIMIZATION
\ No newline at end of file
@@ -3,6 +3,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "ECFTypes.h"
 #include "ECFActionSettings.generated.h"
 
 USTRUCT(BlueprintType)
@@ -15,17 +16,19 @@ struct ENHANCEDCODEFLOW_API FECFActionSettings
 		FirstDelay(0.f),
 		bIgnorePause(false),
 		bIgnoreGlobalTimeDilation(false),
-		bStartPaused(false)
+		bStartPaused(false),
+		TickGroup(EECFTickGroup::Default)
 	{
 
 	}
 
-	FECFActionSettings(float InTickInterval, float InFirstDelay = 0.f, bool InIgnorePause = false, bool InIgnoreTimeDilation = false, bool InStartPaused = false) :
+	FECFActionSettings(float InTickInterval, float InFirstDelay = 0.f, bool InIgnorePause = false, bool InIgnoreTimeDilation = false, bool InStartPaused = false, EECFTickGroup InTickGroup = EECFTickGroup::Default) :
 		TickInterval(InTickInterval),
 		FirstDelay(InFirstDelay),
 		bIgnorePause(InIgnorePause),
 		bIgnoreGlobalTimeDilation(InIgnoreTimeDilation),
-		bStartPaused(InStartPaused)
+		bStartPaused(InStartPaused),
+		TickGroup(InTickGroup)
 	{
 
 	}
@@ -44,6 +47,9 @@ struct ENHANCEDCODEFLOW_API FECFActionSettings
 
 	UPROPERTY(BlueprintReadWrite, Category = "ECF")
 	bool bStartPaused = false;
+
+	UPROPERTY(BlueprintReadWrite, Category = "ECF")
+	EECFTickGroup TickGroup = EECFTickGroup::Default;
 };
 
 #define ECF_TICKINTERVAL(_Interval) FECFActionSettings(_Interval, 0.f, false, false, false)
@@ -52,3 +58,4 @@ struct ENHANCEDCODEFLOW_API FECFActionSettings
 #define ECF_IGNORETIMEDILATION FECFActionSettings(0.f, 0.f, false, true, false)
 #define ECF_IGNOREPAUSEDILATION FECFActionSettings(0.f, 0.f, true, true, false)
 #define ECF_STARTPAUSED FECFActionSettings(0.f, 0.f, false, false, true)
+#define ECF_TICKGROUP(_TickGroup) FECFActionSettings(0.f, 0.f, false, false, false, _TickGroup)
@@ -0,0 +1,70 @@
+// Copyright (c) 2024 Damian Nowakowski. All rights reserved.
+
+/**
+ * Describes where async tasks of ECF actions are launched.
+ * By default tasks run on the background threads of the task graph with the given EECFAsyncPrio.
+ * Heavy IO jobs can be moved to a separate thread pool (e.g. GIOThreadPool), so they won't compete with cpu bound jobs,
+ * and order sensitive jobs can be launched in a pipe, which runs them one after another without any locks.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ECFTypes.h"
+#include "Async/TaskGraphInterfaces.h"
+#include "Runtime/Launch/Resources/Version.h"
+#if (ENGINE_MAJOR_VERSION == 5)
+#include "Tasks/Task.h"
+#include "Tasks/Pipe.h"
+#endif
+
+ECF_PRAGMA_DISABLE_OPTIMIZATION
+
+class FQueuedThreadPool;
+
+class ENHANCEDCODEFLOW_API FECFAsyncExecutor
+{
+
+public:
+
+	// Background threads of the task graph. Implicit, so EECFAsyncPrio can be passed wherever an executor is expected.
+	FECFAsyncExecutor(EECFAsyncPrio InThreadPriority = EECFAsyncPrio::Normal);
+
+	// Queued thread pool, e.g. GIOThreadPool. The pool must outlive the tasks launched in it.
+	static FECFAsyncExecutor ThreadPool(FQueuedThreadPool* InThreadPool);
+
+#if (ENGINE_MAJOR_VERSION == 5)
+	// Tasks system with the given priority.
+	static FECFAsyncExecutor Tasks(UE::Tasks::ETaskPriority InTaskPriority);
+
+	// Pipe, which runs it's tasks one after another. The pipe must outlive the tasks launched in it.
+	static FECFAsyncExecutor Pipe(const TSharedPtr<UE::Tasks::FPipe, ESPMode::ThreadSafe>& InPipe, UE::Tasks::ETaskPriority InTaskPriority = UE::Tasks::ETaskPriority::Normal);
+
+	// Creates a pipe which can be shared between many async actions.
+	static TSharedPtr<UE::Tasks::FPipe, ESPMode::ThreadSafe> MakePipe(const TCHAR* InDebugName);
+#endif
+
+	// Launches the task on this executor.
+	void Launch(TUniqueFunction<void()>&& InTask) const;
+
+private:
+
+	enum class EExecutorType : uint8
+	{
+		TaskGraph,
+		ThreadPool,
+		Tasks,
+		Pipe
+	};
+
+	EExecutorType ExecutorType = EExecutorType::TaskGraph;
+	ENamedThreads::Type ThreadType = ENamedThreads::AnyBackgroundThreadNormalTask;
+	FQueuedThreadPool* QueuedThreadPool = nullptr;
+
+#if (ENGINE_MAJOR_VERSION == 5)
+	UE::Tasks::ETaskPriority TaskPriority = UE::Tasks::ETaskPriority::Normal;
+	TSharedPtr<UE::Tasks::FPipe, ESPMode::ThreadSafe> TaskPipe;
+#endif
+};
+
+ECF_PRAGMA_ENABLE_OPTIMIZATION
@@ -0,0 +1,73 @@
+// Copyright (c) 2024 Damian Nowakowski. All rights reserved.
+
+/**
+ * Graph of async stages run by the RunAsyncGraph action.
+ * Every stage starts on a worker thread as soon as all of it's prerequisites have finished,
+ * so multi-stage pipelines (e.g. load -> decompress -> build) don't have to return to the game thread between stages.
+ * Stages can only depend on stages added before them, so the graph can't contain cycles.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ECFCancellationToken.h"
+#include "ECFAsyncExecutor.h"
+
+ECF_PRAGMA_DISABLE_OPTIMIZATION
+
+class ENHANCEDCODEFLOW_API FECFAsyncGraph
+{
+
+public:
+
+	/**
+	 * Adds a stage to the graph.
+	 * @param InStageFunc		- a function that will be running on a separate thread. Must be: [](const FECFCancellationToken& Token) -> void.
+	 * @param InPrerequisites	- ids of stages which must finish before this stage starts.
+	 * @param InExecutor		- where the stage runs. Can be a thread priority (Normal or HiPriority) or an FECFAsyncExecutor.
+	 * @return					- id of the added stage, which can be used as a prerequisite of next stages.
+	 */
+	int32 AddStage(TUniqueFunction<void(const FECFCancellationToken&/* Token*/)>&& InStageFunc, const TArray<int32>& InPrerequisites = {}, const FECFAsyncExecutor& InExecutor = EECFAsyncPrio::Normal);
+	int32 AddStage(TUniqueFunction<void()>&& InStageFunc, const TArray<int32>& InPrerequisites = {}, const FECFAsyncExecutor& InExecutor = EECFAsyncPrio::Normal);
+
+	// Checks if the graph has any stages and all of them have been added properly.
+	bool IsValid() const
+	{
+		return bIsValid && (Stages.Num() > 0);
+	}
+
+	// Number of stages in the graph.
+	int32 Num() const
+	{
+		return Stages.Num();
+	}
+
+	/**
+	 * Launches all stages of the graph. Stages are skipped when the token is cancelled.
+	 * The OnFinished function is called on a worker thread after the last stage has ended.
+	 */
+	static void Launch(const TSharedRef<FECFAsyncGraph, ESPMode::ThreadSafe>& InGraph, const FECFCancellationToken& InToken, TUniqueFunction<void()>&& InOnFinished);
+
+private:
+
+	static void LaunchStage(const TSharedRef<FECFAsyncGraph, ESPMode::ThreadSafe>& InGraph, int32 StageId);
+
+	struct FStage
+	{
+		TUniqueFunction<void(const FECFCancellationToken&)> StageFunc;
+		FECFAsyncExecutor Executor;
+		int32 PrerequisitesNum = 0;
+		TArray<int32> Dependents;
+	};
+
+	TArray<FStage> Stages;
+	bool bIsValid = true;
+
+	// Runtime state, shared by worker threads.
+	TArray<int32> PendingPrerequisites;
+	int32 PendingStages = 0;
+	FECFCancellationToken Token;
+	TUniqueFunction<void()> OnFinished;
+};
+
+ECF_PRAGMA_ENABLE_OPTIMIZATION
@@ -0,0 +1,54 @@
+// Copyright (c) 2024 Damian Nowakowski. All rights reserved.
+
+/**
+ * Shared state of async tasks returning a result.
+ * The worker thread stores the result here and the game thread moves it out when the action completes.
+ * It is shared between both threads, so the worker can finish safely even if the action has already ended (e.g. timed out).
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ECFCancellationToken.h"
+#include <atomic>
+
+ECF_PRAGMA_DISABLE_OPTIMIZATION
+
+template<typename TResult>
+class TECFAsyncResult
+{
+
+public:
+
+	explicit TECFAsyncResult(TUniqueFunction<TResult(const FECFCancellationToken&)>&& InAsyncTaskFunc)
+		: AsyncTaskFunc(MoveTemp(InAsyncTaskFunc))
+	{}
+
+	// Runs the async task function and stores it's result. Called on the worker thread.
+	void Run(const FECFCancellationToken& Token)
+	{
+		Result.Emplace(AsyncTaskFunc(Token));
+		bHasResult.store(true, std::memory_order_release);
+	}
+
+	// Moves the result out. Returns an unset optional if the task hasn't finished yet
+	// or the result has already been consumed. Called on the game thread.
+	TOptional<TResult> ConsumeResult()
+	{
+		if (bHasResult.exchange(false, std::memory_order_acquire))
+		{
+			TOptional<TResult> ConsumedResult(MoveTemp(Result.GetValue()));
+			Result.Reset();
+			return ConsumedResult;
+		}
+		return TOptional<TResult>();
+	}
+
+private:
+
+	TUniqueFunction<TResult(const FECFCancellationToken&)> AsyncTaskFunc;
+	TOptional<TResult> Result;
+	std::atomic<bool> bHasResult = { false };
+};
+
+ECF_PRAGMA_ENABLE_OPTIMIZATION
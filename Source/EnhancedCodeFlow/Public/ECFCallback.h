@@ -0,0 +1,205 @@
+// Copyright (c) 2024 Damian Nowakowski. All rights reserved.
+
+/**
+ * Callback of an action, which can be set with any function (lambda, TUniqueFunction, function pointer)
+ * taking all arguments of the callback or only the first ones of them (e.g. a function without the trailing bStopped).
+ * Only the given function is stored. The signature is adapted at compile time when the callback is called,
+ * so there is no need for extra functions wrapping the given one.
+ * Functions not bigger than the inline buffer (ECF_CALLBACK_INLINE_SIZE bytes by default) are stored inside the callback,
+ * so they live in the memory of the action, without a separate allocation. Bigger functions are allocated on the heap
+ * and counted by the "Heap Callbacks" stat.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ECFStats.h"
+#include <cstddef>
+#include <tuple>
+#include <utility>
+#include <type_traits>
+
+ECF_PRAGMA_DISABLE_OPTIMIZATION
+
+// Size in bytes of functions which can be stored inside of a callback.
+// Can be overriden in the project's build settings, e.g. if the "Heap Callbacks" stat shows many functions don't fit in.
+#ifndef ECF_CALLBACK_INLINE_SIZE
+#define ECF_CALLBACK_INLINE_SIZE 64
+#endif
+
+namespace ECFCallback_Private
+{
+	// Checks if the function can be called with only the arguments of the given indices.
+	template<typename FunctorType, typename IndicesType, typename... ArgTypes>
+	struct TIsPrefixInvocable;
+
+	template<typename FunctorType, SIZE_T... Indices, typename... ArgTypes>
+	struct TIsPrefixInvocable<FunctorType, std::index_sequence<Indices...>, ArgTypes...>
+	{
+		static constexpr bool Value = std::is_invocable_v<FunctorType&, std::tuple_element_t<Indices, std::tuple<ArgTypes...>>...>;
+	};
+}
+
+template<typename FuncType, SIZE_T InlineSize = ECF_CALLBACK_INLINE_SIZE>
+class TECFCallback;
+
+template<typename... ArgTypes, SIZE_T InlineSize>
+class TECFCallback<void(ArgTypes...), InlineSize>
+{
+	static_assert(InlineSize >= sizeof(void*), "ECF - the inline size of the callback must fit at least a pointer.");
+
+	// Returns the number of the first arguments of this callback the function takes (the most it can), or -1 if it can't take them.
+	template<typename FunctorType, SIZE_T ArgsNum = sizeof...(ArgTypes)>
+	static constexpr int32 GetArgsNum()
+	{
+		if constexpr (ECFCallback_Private::TIsPrefixInvocable<FunctorType, std::make_index_sequence<ArgsNum>, ArgTypes...>::Value)
+		{
+			return static_cast<int32>(ArgsNum);
+		}
+		else if constexpr (ArgsNum == 0)
+		{
+			return -1;
+		}
+		else
+		{
+			return GetArgsNum<FunctorType, ArgsNum - 1>();
+		}
+	}
+
+	// Functions operating on the stored function of a known type.
+	struct FOps
+	{
+		void (*Call)(void* Storage, ArgTypes... Args);
+		void (*Destroy)(void* Storage);
+	};
+
+	template<typename FunctorType, SIZE_T ArgsNum, bool bIsInline>
+	struct TOps
+	{
+		static FunctorType& GetFunc(void* Storage)
+		{
+			if constexpr (bIsInline)
+			{
+				return *static_cast<FunctorType*>(Storage);
+			}
+			else
+			{
+				return **static_cast<FunctorType**>(Storage);
+			}
+		}
+
+		static void Call(void* Storage, ArgTypes... Args)
+		{
+			CallPrefix(GetFunc(Storage), std::make_index_sequence<ArgsNum>(), std::forward_as_tuple(Forward<ArgTypes>(Args)...));
+		}
+
+		static void Destroy(void* Storage)
+		{
+			if constexpr (bIsInline)
+			{
+				DestructItem(&GetFunc(Storage));
+			}
+			else
+			{
+				delete &GetFunc(Storage);
+#if STATS
+				DEC_DWORD_STAT(STAT_ECF_HeapCallbacksCount);
+#endif
+			}
+		}
+
+		static constexpr FOps OpsTable = { &Call, &Destroy };
+	};
+
+public:
+
+	// Checks if the function can be set to this callback.
+	template<typename FunctorType>
+	static constexpr bool IsCallable = GetArgsNum<std::decay_t<FunctorType>>() >= 0;
+
+	TECFCallback() = default;
+
+	TECFCallback(const TECFCallback&) = delete;
+	TECFCallback& operator=(const TECFCallback&) = delete;
+
+	~TECFCallback()
+	{
+		Reset();
+	}
+
+	// Sets the function. It must take all arguments of this callback or only the first ones of them.
+	template<typename FunctorType>
+	TECFCallback& operator=(FunctorType&& InFunc)
+	{
+		using FFunctorType = std::decay_t<FunctorType>;
+		constexpr int32 ArgsNum = GetArgsNum<FFunctorType>();
+		static_assert(ArgsNum >= 0, "ECF - the callback function must take the first arguments of the callback (or none of them).");
+
+		Reset();
+
+		// Empty TUniqueFunctions and null function pointers are not stored.
+		if constexpr (std::is_constructible_v<bool, const FFunctorType&>)
+		{
+			if (!InFunc)
+			{
+				return *this;
+			}
+		}
+
+		if constexpr ((sizeof(FFunctorType) <= InlineSize) && (alignof(FFunctorType) <= alignof(std::max_align_t)))
+		{
+			new (Storage) FFunctorType(Forward<FunctorType>(InFunc));
+			Ops = &TOps<FFunctorType, ArgsNum, true>::OpsTable;
+		}
+		else
+		{
+			*reinterpret_cast<FFunctorType**>(Storage) = new FFunctorType(Forward<FunctorType>(InFunc));
+			Ops = &TOps<FFunctorType, ArgsNum, false>::OpsTable;
+#if STATS
+			INC_DWORD_STAT(STAT_ECF_HeapCallbacksCount);
+#endif
+		}
+		return *this;
+	}
+
+	TECFCallback& operator=(TYPE_OF_NULLPTR)
+	{
+		Reset();
+		return *this;
+	}
+
+	// Checks if the function is set.
+	explicit operator bool() const
+	{
+		return Ops != nullptr;
+	}
+
+	// Calls the function with as many arguments as it takes.
+	void operator()(ArgTypes... Args) const
+	{
+		Ops->Call(const_cast<uint8*>(Storage), Forward<ArgTypes>(Args)...);
+	}
+
+	// Removes the function.
+	void Reset()
+	{
+		if (Ops)
+		{
+			Ops->Destroy(Storage);
+			Ops = nullptr;
+		}
+	}
+
+private:
+
+	template<typename FunctorType, SIZE_T... Indices, typename ArgsTupleType>
+	static void CallPrefix(FunctorType& Func, std::index_sequence<Indices...>, ArgsTupleType&& ArgsTuple)
+	{
+		Func(std::get<Indices>(MoveTemp(ArgsTuple))...);
+	}
+
+	const FOps* Ops = nullptr;
+	alignas(std::max_align_t) uint8 Storage[InlineSize];
+};
+
+ECF_PRAGMA_ENABLE_OPTIMIZATION
@@ -0,0 +1,57 @@
+// Copyright (c) 2024 Damian Nowakowski. All rights reserved.
+
+/**
+ * Token passed to async task functions. It is cancelled when the action running the task
+ * has been stopped, has timed out or it's owner is no longer valid.
+ * Long running tasks should check it and return early when cancelled, so they won't occupy worker threads for nothing.
+ * It is safe to copy and check from any thread.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include <atomic>
+
+ECF_PRAGMA_DISABLE_OPTIMIZATION
+
+class FECFCancellationToken
+{
+
+public:
+
+	FECFCancellationToken()
+		: bIsCancelled(MakeShared<std::atomic<bool>, ESPMode::ThreadSafe>(false))
+	{}
+
+	// Checks if the task should stop it's work.
+	bool IsCancelled() const
+	{
+		return bIsCancelled->load(std::memory_order_relaxed);
+	}
+
+	// Cancels every copy of this token.
+	void Cancel() const
+	{
+		bIsCancelled->store(true, std::memory_order_relaxed);
+	}
+
+	// Adapts the async task function which doesn't check the cancellation token.
+	template<typename TResult>
+	static TUniqueFunction<TResult(const FECFCancellationToken&)> AdaptTaskFunc(TUniqueFunction<TResult()>&& InAsyncTaskFunc)
+	{
+		if (InAsyncTaskFunc)
+		{
+			return [AsyncTaskFunc = MoveTemp(InAsyncTaskFunc)](const FECFCancellationToken& Token) -> TResult
+			{
+				return AsyncTaskFunc();
+			};
+		}
+		return nullptr;
+	}
+
+private:
+
+	TSharedRef<std::atomic<bool>, ESPMode::ThreadSafe> bIsCancelled;
+};
+
+ECF_PRAGMA_ENABLE_OPTIMIZATION
@@ -51,6 +51,12 @@ public:
 		return Handle != Other.Handle;
 	}
 
+	// Hash of the handle, so it can be used as a key of maps.
+	friend uint32 GetTypeHash(const FECFHandle& InHandle)
+	{
+		return ::GetTypeHash(InHandle.Handle);
+	}
+
 	// Copy.
 	FECFHandle& operator=(const FECFHandle& Other)
 	{
@@ -0,0 +1,124 @@
+// Copyright (c) 2024 Damian Nowakowski. All rights reserved.
+
+/**
+ * Compact form of FECFActionSettings kept by actions.
+ * Settings are packed into a profile with bit flags and deduplicated, so actions with the same settings
+ * point at one shared profile instead of holding their own copies. All actions with default settings
+ * share one static profile, so they don't register anything.
+ * Profiles are reference counted and removed when no action uses them anymore.
+ * Packed settings must be created, copied and destroyed on the Game Thread.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ECFActionSettings.h"
+
+ECF_PRAGMA_DISABLE_OPTIMIZATION
+
+class ENHANCEDCODEFLOW_API FECFPackedActionSettings
+{
+
+public:
+
+	// Default settings.
+	FECFPackedActionSettings();
+
+	FECFPackedActionSettings(const FECFActionSettings& InSettings);
+	FECFPackedActionSettings(const FECFPackedActionSettings& Other);
+	FECFPackedActionSettings& operator=(const FECFPackedActionSettings& Other);
+	~FECFPackedActionSettings();
+
+	float GetTickInterval() const
+	{
+		return Profile->Values.TickInterval;
+	}
+
+	float GetFirstDelay() const
+	{
+		return Profile->Values.FirstDelay;
+	}
+
+	bool IgnoresPause() const
+	{
+		return (Profile->Values.Flags & Flag_IgnorePause) != 0;
+	}
+
+	bool IgnoresGlobalTimeDilation() const
+	{
+		return (Profile->Values.Flags & Flag_IgnoreGlobalTimeDilation) != 0;
+	}
+
+	bool StartsPaused() const
+	{
+		return (Profile->Values.Flags & Flag_StartPaused) != 0;
+	}
+
+	EECFTickGroup GetTickGroup() const
+	{
+		return Profile->Values.TickGroup;
+	}
+
+	// Checks if these are the default settings.
+	bool IsDefault() const;
+
+	// Returns the settings in their full form.
+	FECFActionSettings Unpack() const;
+
+	// Returns the number of different non default settings used by actions.
+	static int32 GetProfilesNum();
+
+private:
+
+	static constexpr uint8 Flag_IgnorePause = 1 << 0;
+	static constexpr uint8 Flag_IgnoreGlobalTimeDilation = 1 << 1;
+	static constexpr uint8 Flag_StartPaused = 1 << 2;
+
+	struct FValues
+	{
+		float TickInterval = 0.f;
+		float FirstDelay = 0.f;
+		uint8 Flags = 0;
+		EECFTickGroup TickGroup = EECFTickGroup::Default;
+
+		// Floats are compared by their bits, so every value (even NaN) finds it's own profile.
+		static uint32 FloatToBits(float Value)
+		{
+			uint32 Bits;
+			FMemory::Memcpy(&Bits, &Value, sizeof(Bits));
+			return Bits;
+		}
+
+		bool operator==(const FValues& Other) const
+		{
+			return (FloatToBits(TickInterval) == FloatToBits(Other.TickInterval)) && (FloatToBits(FirstDelay) == FloatToBits(Other.FirstDelay)) && (Flags == Other.Flags) && (TickGroup == Other.TickGroup);
+		}
+
+		friend uint32 GetTypeHash(const FValues& InValues)
+		{
+			return HashCombine(HashCombine(::GetTypeHash(FloatToBits(InValues.TickInterval)), ::GetTypeHash(FloatToBits(InValues.FirstDelay))), HashCombine(::GetTypeHash(InValues.Flags), ::GetTypeHash(static_cast<uint8>(InValues.TickGroup))));
+		}
+	};
+
+	struct FProfile
+	{
+		FValues Values;
+		int32 RefCount = 0;
+	};
+
+	// Profile shared by all actions with default settings. It is never registered.
+	static const FProfile& GetDefaultProfile();
+
+	// Profiles of non default settings which are currently used.
+	static TMap<FValues, TUniquePtr<FProfile>>& GetProfiles();
+
+	// Finds or registers the profile with the given values.
+	static const FProfile* AcquireProfile(const FValues& InValues);
+
+	// Removes the profile when it is not used by anyone anymore.
+	static void ReleaseProfile(const FProfile* InProfile);
+
+	const FProfile* Profile;
+};
+
+ECF_PRAGMA_ENABLE_OPTIMIZATION
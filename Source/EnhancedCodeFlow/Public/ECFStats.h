@@ -8,7 +8,14 @@
 DECLARE_STATS_GROUP(TEXT("ECF"), STATGROUP_ECF, STATCAT_Advanced);
 DECLARE_STATS_GROUP(TEXT("ECFDetails"), STATGROUP_ECFDETAILS, STATCAT_Advanced);
 DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Actions"), STAT_ECF_ActionsCount, STATGROUP_ECF, ENHANCEDCODEFLOW_API);
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Actions Memory"), STAT_ECF_ActionsMemory, STATGROUP_ECF, ENHANCEDCODEFLOW_API);
 DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Instances"), STAT_ECF_InstancesCount, STATGROUP_ECF, ENHANCEDCODEFLOW_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Batched Timelines"), STAT_ECF_BatchedTimelinesCount, STATGROUP_ECF, ENHANCEDCODEFLOW_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Coroutine Timers"), STAT_ECF_CoroutineTimersCount, STATGROUP_ECF, ENHANCEDCODEFLOW_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Settings Profiles"), STAT_ECF_SettingsProfilesCount, STATGROUP_ECF, ENHANCEDCODEFLOW_API);
 DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Action Objects"), STAT_ECF_ActionsObjectsCount, STATGROUP_ECF, ENHANCEDCODEFLOW_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Heap Callbacks"), STAT_ECF_HeapCallbacksCount, STATGROUP_ECF, ENHANCEDCODEFLOW_API);
 DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Async BP Objects"), STAT_ECF_AsyncBPObjectsCount, STATGROUP_ECF, ENHANCEDCODEFLOW_API);
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Coroutine Frames Memory"), STAT_ECF_CoroutineFramesMemory, STATGROUP_ECF, ENHANCEDCODEFLOW_API);
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Coroutine Frames Pool Memory"), STAT_ECF_CoroutineFramesPoolMemory, STATGROUP_ECF, ENHANCEDCODEFLOW_API);
 #endif
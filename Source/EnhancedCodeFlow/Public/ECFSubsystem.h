@@ -5,23 +5,37 @@
 #include "CoreMinimal.h"
 #include "Subsystems/GameInstanceSubsystem.h"
 #include "Tickable.h"
+#include "Containers/Queue.h"
 #include "ECFHandle.h"
 #include "ECFActionBase.h"
 #include "ECFInstanceId.h"
 #include "ECFActionSettings.h"
 #include "ECFStats.h"
+#include "ECFTimelineBatch.h"
+#include "ECFTickGroupFunction.h"
 #include "Coroutines/ECFCoroutine.h"
+#include "Coroutines/ECFCoroutineScheduler.h"
 #include "ECFSubsystem.generated.h"
 
 ECF_PRAGMA_DISABLE_OPTIMIZATION
 
+class UECFActionBP;
+
 UCLASS()
-class ENHANCEDCODEFLOW_API UECFSubsystem : public UGameInstanceSubsystem, public FTickableGameObject
+class ENHANCEDCODEFLOW_API UECFSubsystem : public UGameInstanceSubsystem, public FTickableGameObject, public FECFCoroutineObserver
 {
 	GENERATED_BODY()
 
 	friend class FEnhancedCodeFlow;
 	friend class FECFCoroutineAwaiter;
+	friend class FECFTimelineBatch;
+	friend class UECFTimeline;
+	friend class UECFRunAsyncThen;
+	friend class UECFRunAsyncGraph;
+	friend class UECFRunAsyncAndWait;
+	friend class FECFWaitCondition_RunAsyncAndWait;
+	friend class UECFActionBP;
+	friend struct FECFTickGroupFunction;
 
 protected:
 
@@ -63,6 +77,8 @@ protected:
 		{
 			NewAction->Init();
 			PendingAddActions.Add(NewAction);
+			ActionsByHandle.Add(NewAction->GetHandleId(), NewAction);
+			RegisterTickGroup(NewAction->Settings.GetTickGroup());
 			return NewAction->GetHandleId();
 		}
 
@@ -82,15 +98,60 @@ protected:
 		}
 
 		// Create and set new coroutine action.
+		// The coroutine can be resumed during the setup already, so it must be marked as suspended before it.
 		T* NewAction = NewObject<T>(this);
 		NewAction->SetCoroutineAction(InOwner, InCoroutineHandle, ++LastHandleId, Settings);
+		MarkCoroutineSuspended(InCoroutineHandle);
 		if (NewAction->Setup(Forward<Ts>(Args)...))
 		{
 			NewAction->Init();
 			PendingAddActions.Add(NewAction);
+			ActionsByHandle.Add(NewAction->GetHandleId(), NewAction);
+			RegisterTickGroup(NewAction->Settings.GetTickGroup());
+		}
+		else if (NewAction->bHasCoroutineHandle)
+		{
+			NewAction->bHasCoroutineHandle = false;
+			InCoroutineHandle.promise().bIsSuspended = false;
 		}
 	}
 
+	// Marks the coroutine as suspended by this subsystem, so it will be notified when the coroutine's frame is destroyed.
+	void MarkCoroutineSuspended(FECFCoroutineHandle InCoroutineHandle)
+	{
+		InCoroutineHandle.promise().Observer = this;
+		InCoroutineHandle.promise().bIsSuspended = true;
+	}
+
+	// Starts the coroutine returned by the given function and tracks it, so it can be stopped with the returned handle.
+	FECFHandle StartCoroutine(const UObject* InOwner, TUniqueFunction<FECFCoroutine()>&& InCoroutineFunc);
+
+	// Checks if the coroutine started with StartCoroutine is still running.
+	bool HasCoroutine(const FECFHandle& HandleId) const;
+
+	// Destroys the coroutine started with StartCoroutine.
+	void StopCoroutine(FECFHandle& HandleId);
+
+	// Destroys coroutines started with StartCoroutine or suspended by this subsystem, assigned to a specific owner (if specified).
+	void StopCoroutines(const UObject* InOwner);
+
+	// Destroys started coroutines which owners are no longer valid.
+	void DestroyOrphanedCoroutines();
+
+	/** FECFCoroutineObserver interface implementation */
+	void OnCoroutineDestroyed(FECFCoroutinePromiseBase& Promise) override;
+
+	// Coroutine started with StartCoroutine.
+	struct FTrackedCoroutine
+	{
+		FECFHandle HandleId;
+		TWeakObjectPtr<const UObject> Owner;
+		FECFCoroutineHandle CoroutineHandle;
+	};
+
+	// List of coroutines started with StartCoroutine which haven't ended yet.
+	TArray<FTrackedCoroutine> TrackedCoroutines;
+
 	// Try to find running or pending action.
 	UECFActionBase* FindAction(const FECFHandle& HandleId) const;
 
@@ -136,6 +197,26 @@ protected:
 	UPROPERTY(Transient)
 	TArray<UECFActionBase*> PendingAddActions;
 
+	// Active and pending actions by their handles, so they can be found without scanning the lists.
+	TMap<FECFHandle, TWeakObjectPtr<UECFActionBase>> ActionsByHandle;
+
+	// Proxies of finished Blueprint async nodes, ready to be reused by next nodes.
+	UPROPERTY(Transient)
+	TArray<UECFActionBP*> PooledBPProxies;
+
+	// Batch evaluating float timelines.
+	FECFTimelineBatch TimelineBatch;
+
+	// Timers of suspended coroutines, resumed without coroutine actions.
+	FECFCoroutineScheduler CoroutineScheduler;
+
+	// Lock-free queue of handles of actions which async tasks have finished. Filled from worker threads.
+	using FAsyncCompletionQueue = TQueue<FECFHandle, EQueueMode::Mpsc>;
+	TSharedPtr<FAsyncCompletionQueue, ESPMode::ThreadSafe> AsyncCompletionQueue;
+
+	// Notifies actions which async tasks have finished since the last tick.
+	void ProcessAsyncCompletions();
+
 	// Id of the last created node.
 	FECFHandle LastHandleId;
 
@@ -155,6 +236,21 @@ private:
 
 	// Indicates if this subsystem should tick
 	bool bCanTick = false;
+
+	// Number of tick groups ticked by their own tick functions (every group except the Default one).
+	static constexpr int32 TickGroupFunctionsNum = static_cast<int32>(EECFTickGroup::PostUpdateWork);
+
+	// Tick functions of tick groups, indexed by the group - 1.
+	FECFTickGroupFunction TickGroupFunctions[TickGroupFunctionsNum];
+
+	// Registers the tick function of the given tick group, if it is not registered yet.
+	void RegisterTickGroup(EECFTickGroup InTickGroup);
+
+	// Registers tick functions of tick groups used by actions and unregisters the ones which are not used anymore.
+	void UpdateTickGroups(const bool (&bUsedTickGroups)[TickGroupFunctionsNum]);
+
+	// Ticks actions of the given tick group. Called by the tick function of this group.
+	void TickActionsInGroup(EECFTickGroup InTickGroup, float DeltaTime);
 };
 
 ECF_PRAGMA_ENABLE_OPTIMIZATION
\ No newline at end of file
@@ -0,0 +1,35 @@
+// Copyright (c) 2024 Damian Nowakowski. All rights reserved.
+
+/**
+ * Tick function of the ECF subsystem registered for one tick group.
+ * It ticks only actions with this tick group set in their settings, at the phase of the frame of this group.
+ * The subsystem registers it only when any action uses the group.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/EngineBaseTypes.h"
+#include "ECFTypes.h"
+
+ECF_PRAGMA_DISABLE_OPTIMIZATION
+
+class UECFSubsystem;
+
+struct ENHANCEDCODEFLOW_API FECFTickGroupFunction : public FTickFunction
+{
+	// Subsystem which actions are ticked.
+	UECFSubsystem* Subsystem = nullptr;
+
+	// Group of actions ticked by this function.
+	EECFTickGroup Group = EECFTickGroup::Default;
+
+	/** FTickFunction interface implementation */
+	void ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent) override;
+	FString DiagnosticMessage() override;
+
+	// Returns the engine's tick group matching the given ECF tick group.
+	static ETickingGroup ToEngineTickGroup(EECFTickGroup InGroup);
+};
+
+ECF_PRAGMA_ENABLE_OPTIMIZATION
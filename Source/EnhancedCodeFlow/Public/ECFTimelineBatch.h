@@ -0,0 +1,92 @@
+// Copyright (c) 2024 Damian Nowakowski. All rights reserved.
+
+/**
+ * Batch engine for simple float timelines.
+ * Instead of evaluating every timeline inside it's own Tick, timelines are grouped by their blend function
+ * and their values are evaluated together in tight SIMD loops over packed arrays.
+ * Timeline actions only advance their time when ticked. Once all actions have ticked the subsystem evaluates
+ * the batch and launches tick callbacks from the result buffer.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ECFTypes.h"
+
+ECF_PRAGMA_DISABLE_OPTIMIZATION
+
+class UECFTimeline;
+struct FECFTimelineSinkFlush;
+
+class ENHANCEDCODEFLOW_API FECFTimelineBatch
+{
+
+public:
+
+	// Checks if timelines batching is enabled (controlled by the ECF.TimelineBatching console variable).
+	static bool IsEnabled();
+
+	// Adds timeline to the batch. Returns false if the batching is disabled.
+	bool AddTimeline(UECFTimeline* Timeline);
+
+	// Removes all timelines which are no longer valid.
+	void RemoveInvalidTimelines();
+
+	// Updates the current time of the batched timeline. Marks it as ticked in this frame.
+	void SetCurrentTime(EECFBlendFunc BlendFunc, int32 Index, float CurrentTime)
+	{
+		FGroup& Group = Groups[static_cast<int32>(BlendFunc)];
+		Group.CurrentTimes[Index] = CurrentTime;
+		Group.Ticked[Index] = true;
+	}
+
+	// Evaluates values of every batched timeline and launches callbacks of the ones that ticked this frame.
+	void Evaluate();
+
+	// Queues the flush of timeline sinks. It will be launched once, after all timelines are evaluated.
+	void QueueFlush(const TSharedPtr<FECFTimelineSinkFlush>& Flush);
+
+	// Launches flushes of timeline sinks written in this frame.
+	void FlushSinks();
+
+	// Removes every timeline and queued flush from the batch.
+	void Reset();
+
+	// Returns the number of batched timelines.
+	int32 Num() const;
+
+	// Evaluates values of the given packed timelines using the given blend function.
+	static void EvaluateValues(EECFBlendFunc BlendFunc, int32 Count, const float* StartValues, const float* StopValues, const float* Times, const float* CurrentTimes, const float* BlendExps, float* OutAlphas, float* OutValues);
+
+#if !UE_BUILD_SHIPPING
+	// Compares the batched and per-object timeline paths. Launched by the ECF.Benchmark.Timelines console command.
+	static void RunBenchmark(const TArray<FString>& Args);
+#endif
+
+private:
+
+	// Packed data of timelines using the same blend function.
+	struct FGroup
+	{
+		TArray<UECFTimeline*> Timelines;
+		TArray<float> StartValues;
+		TArray<float> StopValues;
+		TArray<float> Times;
+		TArray<float> CurrentTimes;
+		TArray<float> BlendExps;
+		TArray<float> Alphas;
+		TArray<float> Values;
+		TArray<bool> Ticked;
+
+		void RemoveAtSwap(int32 Index);
+		void Reset();
+	};
+
+	// One group for every blend function.
+	FGroup Groups[5];
+
+	// Flushes of timeline sinks waiting to be launched in this frame.
+	TArray<TSharedPtr<FECFTimelineSinkFlush>> PendingFlushes;
+};
+
+ECF_PRAGMA_ENABLE_OPTIMIZATION
@@ -0,0 +1,331 @@
+// Copyright (c) 2024 Damian Nowakowski. All rights reserved.
+
+/**
+ * Templates implementing the logic of simple timelines for any type of value.
+ * Blend functions are resolved at compile time. The only runtime choice is made once,
+ * when the timeline is set up, so ticking the timeline does not switch over blend functions.
+ * Timeline actions (Timeline, Timeline Vector, Timeline Linear Color and Typed Timeline) are all using these.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ECFTypes.h"
+
+ECF_PRAGMA_DISABLE_OPTIMIZATION
+
+/*^^^ Blend Functions ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^*/
+
+// Shapes the linear timeline progress (Alpha) with the given blend function.
+// Every blend function is expressed as a Lerp between Start and Stop values with a shaped Alpha.
+template<EECFBlendFunc BlendFunc>
+struct TECFBlendFunc;
+
+template<>
+struct TECFBlendFunc<EECFBlendFunc::ECFBlend_Linear>
+{
+	static FORCEINLINE float Apply(float Alpha, float BlendExp)
+	{
+		return Alpha;
+	}
+};
+
+template<>
+struct TECFBlendFunc<EECFBlendFunc::ECFBlend_Cubic>
+{
+	// Equivalent of the CubicInterp with zero tangents.
+	static FORCEINLINE float Apply(float Alpha, float BlendExp)
+	{
+		return Alpha * Alpha * (3.f - 2.f * Alpha);
+	}
+};
+
+template<>
+struct TECFBlendFunc<EECFBlendFunc::ECFBlend_EaseIn>
+{
+	static FORCEINLINE float Apply(float Alpha, float BlendExp)
+	{
+		return FMath::Pow(Alpha, BlendExp);
+	}
+};
+
+template<>
+struct TECFBlendFunc<EECFBlendFunc::ECFBlend_EaseOut>
+{
+	static FORCEINLINE float Apply(float Alpha, float BlendExp)
+	{
+		return FMath::Pow(Alpha, 1.f / BlendExp);
+	}
+};
+
+template<>
+struct TECFBlendFunc<EECFBlendFunc::ECFBlend_EaseInOut>
+{
+	// Equivalent of the InterpEaseInOut.
+	static FORCEINLINE float Apply(float Alpha, float BlendExp)
+	{
+		return (Alpha < 0.5f)
+			? FMath::Pow(Alpha * 2.f, BlendExp) * 0.5f
+			: 1.f - FMath::Pow(2.f - Alpha * 2.f, BlendExp) * 0.5f;
+	}
+};
+
+/*^^^ Value Traits ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^*/
+
+// Describes how to interpolate and compare values of the given type.
+// By default FMath::Lerp is used. Specialize it for types that must be blended differently.
+template<typename T>
+struct TECFTimelineTraits
+{
+	static FORCEINLINE T Lerp(const T& A, const T& B, float Alpha)
+	{
+		return FMath::Lerp(A, B, Alpha);
+	}
+
+	static FORCEINLINE bool Equals(const T& A, const T& B)
+	{
+		return A == B;
+	}
+
+	// Checks if the values can be blended with each other.
+	static FORCEINLINE bool CanBlend(const T& A, const T& B)
+	{
+		return true;
+	}
+};
+
+template<>
+struct TECFTimelineTraits<FQuat>
+{
+	static FORCEINLINE FQuat Lerp(const FQuat& A, const FQuat& B, float Alpha)
+	{
+		return FQuat::Slerp(A, B, Alpha);
+	}
+
+	static FORCEINLINE bool Equals(const FQuat& A, const FQuat& B)
+	{
+		return A.Equals(B, 0.f);
+	}
+
+	static FORCEINLINE bool CanBlend(const FQuat& A, const FQuat& B)
+	{
+		return true;
+	}
+};
+
+template<>
+struct TECFTimelineTraits<FTransform>
+{
+	static FORCEINLINE FTransform Lerp(const FTransform& A, const FTransform& B, float Alpha)
+	{
+		FTransform Result;
+		Result.Blend(A, B, Alpha);
+		return Result;
+	}
+
+	static FORCEINLINE bool Equals(const FTransform& A, const FTransform& B)
+	{
+		return A.Equals(B, 0.f);
+	}
+
+	static FORCEINLINE bool CanBlend(const FTransform& A, const FTransform& B)
+	{
+		return true;
+	}
+};
+
+template<>
+struct TECFTimelineTraits<TArray<float>>
+{
+	// Blends arrays per element. Both arrays must have the same size.
+	static FORCEINLINE TArray<float> Lerp(const TArray<float>& A, const TArray<float>& B, float Alpha)
+	{
+		TArray<float> Result;
+		Result.SetNumUninitialized(A.Num());
+		for (int32 Index = 0; Index < A.Num(); ++Index)
+		{
+			Result[Index] = FMath::Lerp(A[Index], B[Index], Alpha);
+		}
+		return Result;
+	}
+
+	static FORCEINLINE bool Equals(const TArray<float>& A, const TArray<float>& B)
+	{
+		return A == B;
+	}
+
+	// Arrays are blended per element, so they must have the same size.
+	static FORCEINLINE bool CanBlend(const TArray<float>& A, const TArray<float>& B)
+	{
+		return A.Num() == B.Num();
+	}
+};
+
+/*^^^ Timeline ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^*/
+
+// Timeline of the value type T specialized for the blend function known at compile time.
+template<typename T, EECFBlendFunc BlendFunc>
+struct TECFTimeline
+{
+	static T Evaluate(const T& StartValue, const T& StopValue, float Alpha, float BlendExp)
+	{
+		return TECFTimelineTraits<T>::Lerp(StartValue, StopValue, TECFBlendFunc<BlendFunc>::Apply(Alpha, BlendExp));
+	}
+};
+
+// State of a single timeline of the value type T.
+// The blend function specialization is chosen once in Setup.
+template<typename T>
+class TECFTimelineCore
+{
+
+public:
+
+	using FEvaluateFunc = T(*)(const T&, const T&, float, float);
+
+	T StartValue = T();
+	T StopValue = T();
+	T CurrentValue = T();
+	float Time = 0.f;
+	float CurrentTime = 0.f;
+	float BlendExp = 1.f;
+	EECFBlendFunc BlendFunc = EECFBlendFunc::ECFBlend_Linear;
+
+	// Sets the timeline up. Returns false if the given parameters are not valid.
+	bool Setup(const T& InStartValue, const T& InStopValue, float InTime, EECFBlendFunc InBlendFunc, float InBlendExp)
+	{
+		StartValue = InStartValue;
+		StopValue = InStopValue;
+		CurrentValue = InStartValue;
+		Time = InTime;
+		CurrentTime = 0.f;
+		BlendFunc = InBlendFunc;
+		BlendExp = InBlendExp;
+
+		switch (BlendFunc)
+		{
+		case EECFBlendFunc::ECFBlend_Linear:
+			EvaluateFunc = &TECFTimeline<T, EECFBlendFunc::ECFBlend_Linear>::Evaluate;
+			break;
+		case EECFBlendFunc::ECFBlend_Cubic:
+			EvaluateFunc = &TECFTimeline<T, EECFBlendFunc::ECFBlend_Cubic>::Evaluate;
+			break;
+		case EECFBlendFunc::ECFBlend_EaseIn:
+			EvaluateFunc = &TECFTimeline<T, EECFBlendFunc::ECFBlend_EaseIn>::Evaluate;
+			break;
+		case EECFBlendFunc::ECFBlend_EaseOut:
+			EvaluateFunc = &TECFTimeline<T, EECFBlendFunc::ECFBlend_EaseOut>::Evaluate;
+			break;
+		case EECFBlendFunc::ECFBlend_EaseInOut:
+			EvaluateFunc = &TECFTimeline<T, EECFBlendFunc::ECFBlend_EaseInOut>::Evaluate;
+			break;
+		}
+
+		return EvaluateFunc && Time > 0.f && BlendExp != 0.f && TECFTimelineTraits<T>::CanBlend(StartValue, StopValue) && (TECFTimelineTraits<T>::Equals(StartValue, StopValue) == false);
+	}
+
+	// Advances the time of the timeline without evaluating it's value. Returns the timeline progress (0 - 1).
+	float AdvanceTime(float DeltaTime)
+	{
+		CurrentTime = FMath::Clamp(CurrentTime + DeltaTime, 0.f, Time);
+		return CurrentTime / Time;
+	}
+
+	// Advances the timeline and evaluates it's current value. Returns true if the timeline has reached it's end.
+	bool Tick(float DeltaTime)
+	{
+		const float Alpha = AdvanceTime(DeltaTime);
+		if (Alpha >= 1.f)
+		{
+			CurrentValue = StopValue;
+			return true;
+		}
+
+		CurrentValue = EvaluateFunc(StartValue, StopValue, Alpha, BlendExp);
+		return false;
+	}
+
+private:
+
+	// Evaluation function of the chosen blend function.
+	FEvaluateFunc EvaluateFunc = nullptr;
+};
+
+/*^^^ Typed Timeline ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^*/
+
+// Type erased timeline used by the Typed Timeline action, so a single action class can run timelines of any value type.
+class FECFTypedTimelineBase
+{
+
+public:
+
+	virtual ~FECFTypedTimelineBase() {}
+
+	// Returns true if the timeline has been set up correctly.
+	virtual bool IsSetupValid() const = 0;
+
+	// Returns true if the start and stop values can be blended with each other (e.g. arrays have the same size).
+	virtual bool CanBlendValues() const = 0;
+
+	// Returns the total time of the timeline.
+	virtual float GetTime() const = 0;
+
+	// Advances the timeline and launches it's tick function. Returns true if the timeline has reached it's end.
+	virtual bool Tick(float DeltaTime) = 0;
+
+	// Launches the callback of the timeline.
+	virtual void Complete(bool bStopped) = 0;
+};
+
+template<typename T>
+class TECFTypedTimeline : public FECFTypedTimelineBase
+{
+
+public:
+
+	TECFTypedTimeline(const T& InStartValue, const T& InStopValue, float InTime, TUniqueFunction<void(const T&, float)>&& InTickFunc, TUniqueFunction<void(const T&, float, bool)>&& InCallbackFunc, EECFBlendFunc InBlendFunc, float InBlendExp)
+		: TickFunc(MoveTemp(InTickFunc))
+		, CallbackFunc(MoveTemp(InCallbackFunc))
+	{
+		bIsSetupValid = MyTimeline.Setup(InStartValue, InStopValue, InTime, InBlendFunc, InBlendExp) && TickFunc;
+	}
+
+	bool IsSetupValid() const override
+	{
+		return bIsSetupValid;
+	}
+
+	bool CanBlendValues() const override
+	{
+		return TECFTimelineTraits<T>::CanBlend(MyTimeline.StartValue, MyTimeline.StopValue);
+	}
+
+	float GetTime() const override
+	{
+		return MyTimeline.Time;
+	}
+
+	bool Tick(float DeltaTime) override
+	{
+		const bool bFinished = MyTimeline.Tick(DeltaTime);
+		TickFunc(MyTimeline.CurrentValue, MyTimeline.CurrentTime);
+		return bFinished;
+	}
+
+	void Complete(bool bStopped) override
+	{
+		if (CallbackFunc)
+		{
+			CallbackFunc(MyTimeline.CurrentValue, MyTimeline.CurrentTime, bStopped);
+		}
+	}
+
+private:
+
+	TECFTimelineCore<T> MyTimeline;
+	TUniqueFunction<void(const T&, float)> TickFunc;
+	TUniqueFunction<void(const T&, float, bool)> CallbackFunc;
+	bool bIsSetupValid = false;
+};
+
+ECF_PRAGMA_ENABLE_OPTIMIZATION
@@ -0,0 +1,87 @@
+// Copyright (c) 2024 Damian Nowakowski. All rights reserved.
+
+/**
+ * Sinks for float timelines. Instead of launching a tick function every frame,
+ * the timeline writes it's current value directly into a memory location or a float property of an object.
+ * Sinks can share a flush function, which is launched once per frame after every ticked sink using it has been written.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/WeakObjectPtrTemplates.h"
+
+ECF_PRAGMA_DISABLE_OPTIMIZATION
+
+class FFloatProperty;
+class FDoubleProperty;
+
+// Flush function shared by timeline sinks.
+struct ENHANCEDCODEFLOW_API FECFTimelineSinkFlush
+{
+	FECFTimelineSinkFlush(TUniqueFunction<void()>&& InFlushFunc)
+		: FlushFunc(MoveTemp(InFlushFunc))
+	{}
+
+	TUniqueFunction<void()> FlushFunc;
+
+	// Set when the flush is waiting to be launched at the end of the current frame.
+	bool bIsQueued = false;
+};
+
+struct ENHANCEDCODEFLOW_API FECFTimelineSink
+{
+	/**
+	 * Creates a sink writing to the given memory location.
+	 * The memory must stay valid until the timeline ends. Usually it is a member of the timeline owner.
+	 */
+	static FECFTimelineSink Memory(float* InTarget, const TSharedPtr<FECFTimelineSinkFlush>& InFlush = nullptr);
+
+	/**
+	 * Creates a sink writing to the float (or double) property of the given object.
+	 * The property is resolved once. The sink stops writing when the object is destroyed.
+	 */
+	static FECFTimelineSink Property(UObject* InObject, FName InPropertyName, const TSharedPtr<FECFTimelineSinkFlush>& InFlush = nullptr);
+
+	// Creates a flush function which can be shared between many sinks.
+	static TSharedPtr<FECFTimelineSinkFlush> MakeFlush(TUniqueFunction<void()>&& InFlushFunc);
+
+	// Checks if the sink has something to write to.
+	bool IsSet() const
+	{
+		return MemoryTarget || PropertyObject.IsExplicitlyNull() == false;
+	}
+
+	// Writes the value to the sink. Returns true if the flush of this sink must be queued.
+	bool Write(float Value)
+	{
+		if (MemoryTarget)
+		{
+			*MemoryTarget = Value;
+		}
+		else if (UObject* Object = PropertyObject.Get())
+		{
+			WriteProperty(Object, Value);
+		}
+		else
+		{
+			return false;
+		}
+
+		return Flush.IsValid() && (Flush->bIsQueued == false);
+	}
+
+	// Flush function of this sink. Can be empty.
+	TSharedPtr<FECFTimelineSinkFlush> Flush;
+
+private:
+
+	void WriteProperty(UObject* Object, float Value);
+
+	float* MemoryTarget = nullptr;
+	TWeakObjectPtr<UObject> PropertyObject;
+	FFloatProperty* FloatProperty = nullptr;
+	FDoubleProperty* DoubleProperty = nullptr;
+};
+
+ECF_PRAGMA_ENABLE_OPTIMIZATION
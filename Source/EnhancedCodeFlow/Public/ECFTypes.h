@@ -16,6 +16,19 @@ enum class EECFBlendFunc : uint8
 	ECFBlend_EaseInOut
 };
 
+// Phases of the frame in which actions can tick.
+// Default actions tick together with the ECF subsystem, after the world's tick groups.
+// Other groups tick with the engine's tick groups of the same names.
+UENUM(BlueprintType)
+enum class EECFTickGroup : uint8
+{
+	Default,
+	PrePhysics,
+	DuringPhysics,
+	PostPhysics,
+	PostUpdateWork
+};
+
 // Possible priorities for async tasks in ECF system.
 UENUM(BlueprintType)
 enum class EECFAsyncPrio : uint8
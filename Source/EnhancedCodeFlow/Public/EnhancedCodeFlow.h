@@ -31,7 +31,18 @@
 #include "ECFTypes.h"
 #include "ECFActionSettings.h"
 #include "ECFInstanceId.h"
+#include "ECFTimelineCore.h"
+#include "ECFTimelineSink.h"
+#include "ECFCancellationToken.h"
+#include "ECFAsyncExecutor.h"
+#include "ECFAsyncGraph.h"
+#include "ECFSubsystem.h"
+#include "CodeFlowActions/ECFDelay.h"
+#include "CodeFlowActions/ECFDelayTicks.h"
+#include "CodeFlowActions/ECFWaitAndExecute.h"
+#include "CodeFlowActions/ECFWaitAndExecute_WithDeltaTime.h"
 #include "Coroutines/ECFCoroutineAwaiters.h"
+#include "Coroutines/ECFTask.h"
 
 class ENHANCEDCODEFLOW_API FEnhancedCodeFlow
 {
@@ -137,6 +148,17 @@ public:
 	static FECFHandle Delay(const UObject* InOwner, float InDelayTime, TUniqueFunction<void(bool/* bStopped*/)>&& InCallbackFunc, const FECFActionSettings& Settings = {});
 	static FECFHandle Delay(const UObject* InOwner, float InDelayTime, TUniqueFunction<void()>&& InCallbackFunc, const FECFActionSettings& Settings = {});
 
+	// The same as above, but the callback is moved straight into the action instead of being wrapped in a TUniqueFunction.
+	// Callbacks not bigger than ECF_CALLBACK_INLINE_SIZE bytes are stored inside the action, without a separate allocation.
+	template<typename TFunc, typename = typename TEnableIf<TECFCallback<void(bool)>::IsCallable<TFunc>>::Type>
+	static FECFHandle Delay(const UObject* InOwner, float InDelayTime, TFunc&& InCallbackFunc, const FECFActionSettings& Settings = {})
+	{
+		if (UECFSubsystem* ECF = UECFSubsystem::Get(InOwner))
+			return ECF->AddAction<UECFDelay>(InOwner, Settings, FECFInstanceId(), InDelayTime, Forward<TFunc>(InCallbackFunc));
+		else
+			return FECFHandle();
+	}
+
 	/**
 	 * Stops all delays.
 	 * @param bComplete			 - indicates if the action should be completed when stopped (run callback), or simply stopped.
@@ -158,6 +180,17 @@ public:
 	static FECFHandle DelayTicks(const UObject* InOwner, int32 InDelayTicks, TUniqueFunction<void(bool/* bStopped*/)>&& InCallbackFunc, const FECFActionSettings& Settings = {});
 	static FECFHandle DelayTicks(const UObject* InOwner, int32 InDelayTicks, TUniqueFunction<void()>&& InCallbackFunc, const FECFActionSettings& Settings = {});
 
+	// The same as above, but the callback is moved straight into the action instead of being wrapped in a TUniqueFunction.
+	// Callbacks not bigger than ECF_CALLBACK_INLINE_SIZE bytes are stored inside the action, without a separate allocation.
+	template<typename TFunc, typename = typename TEnableIf<TECFCallback<void(bool)>::IsCallable<TFunc>>::Type>
+	static FECFHandle DelayTicks(const UObject* InOwner, int32 InDelayTicks, TFunc&& InCallbackFunc, const FECFActionSettings& Settings = {})
+	{
+		if (UECFSubsystem* ECF = UECFSubsystem::Get(InOwner))
+			return ECF->AddAction<UECFDelayTicks>(InOwner, Settings, FECFInstanceId(), InDelayTicks, Forward<TFunc>(InCallbackFunc));
+		else
+			return FECFHandle();
+	}
+
 	/**
 	 * Stops all delay ticks.
 	 * @param bComplete			 - indicates if the action should be completed when stopped (run callback), or simply stopped.
@@ -188,6 +221,26 @@ public:
 	static FECFHandle WaitAndExecute(const UObject* InOwner, TUniqueFunction<bool/* bHasFinished*/(float/* DeltaTime*/)>&& InPredicate, TUniqueFunction<void(bool/* bTimedOut*/)>&& InCallbackFunc, float InTimeOut = 0.f, const FECFActionSettings& Settings = {});
 	static FECFHandle WaitAndExecute(const UObject* InOwner, TUniqueFunction<bool/* bHasFinished*/(float/* DeltaTime*/)>&& InPredicate, TUniqueFunction<void()>&& InCallbackFunc, float InTimeOut = 0.f, const FECFActionSettings& Settings = {});
 
+	// The same as above, but the callback is moved straight into the action instead of being wrapped in a TUniqueFunction.
+	// Callbacks not bigger than ECF_CALLBACK_INLINE_SIZE bytes are stored inside the action, without a separate allocation.
+	template<typename TFunc, typename = typename TEnableIf<TECFCallback<void(bool, bool)>::IsCallable<TFunc>>::Type>
+	static FECFHandle WaitAndExecute(const UObject* InOwner, TUniqueFunction<bool/* bHasFinished*/()>&& InPredicate, TFunc&& InCallbackFunc, float InTimeOut = 0.f, const FECFActionSettings& Settings = {})
+	{
+		if (UECFSubsystem* ECF = UECFSubsystem::Get(InOwner))
+			return ECF->AddAction<UECFWaitAndExecute>(InOwner, Settings, FECFInstanceId(), MoveTemp(InPredicate), Forward<TFunc>(InCallbackFunc), InTimeOut);
+		else
+			return FECFHandle();
+	}
+
+	template<typename TFunc, typename = typename TEnableIf<TECFCallback<void(bool, bool)>::IsCallable<TFunc>>::Type>
+	static FECFHandle WaitAndExecute(const UObject* InOwner, TUniqueFunction<bool/* bHasFinished*/(float/* DeltaTime*/)>&& InPredicate, TFunc&& InCallbackFunc, float InTimeOut = 0.f, const FECFActionSettings& Settings = {})
+	{
+		if (UECFSubsystem* ECF = UECFSubsystem::Get(InOwner))
+			return ECF->AddAction<UECFWaitAndExecute_WithDeltaTime>(InOwner, Settings, FECFInstanceId(), MoveTemp(InPredicate), Forward<TFunc>(InCallbackFunc), InTimeOut);
+		else
+			return FECFHandle();
+	}
+
 
 	/**
 	 * Stops "wait and execute" actions.
@@ -241,6 +294,24 @@ public:
 	static FECFHandle AddTimeline(const UObject* InOwner, float InStartValue, float InStopValue, float InTime, TUniqueFunction<void(float/* Value*/, float/* Time*/)>&& InTickFunc, TUniqueFunction<void(float/* Value*/, float/* Time*/, bool/* bStopped*/)>&& InCallbackFunc = nullptr, EECFBlendFunc InBlendFunc = EECFBlendFunc::ECFBlend_Linear, float InBlendExp = 1.f, const FECFActionSettings& Settings = {});
 	static FECFHandle AddTimeline(const UObject* InOwner, float InStartValue, float InStopValue, float InTime, TUniqueFunction<void(float/* Value*/, float/* Time*/)>&& InTickFunc, TUniqueFunction<void(float/* Value*/, float/* Time*/)>&& InCallbackFunc = nullptr, EECFBlendFunc InBlendFunc = EECFBlendFunc::ECFBlend_Linear, float InBlendExp = 1.f, const FECFActionSettings& Settings = {});
 
+	/**
+	 * Adds a simple timeline which writes it's value directly to the given sink instead of launching a tick function.
+	 * @param InStartValue -    the value from which this timeline will start.
+	 * @param InStopValue -     the value to which this timeline will go. Must be different than InStartValue.
+	 * @param InTime -          how long the timeline will be processed? Must be greater than 0.
+	 * @param InSink -          the memory location or the float property the value will be written to. 
+	 *                          Use FECFTimelineSink::Memory or FECFTimelineSink::Property to create it.
+	 *                          The optional flush function of the sink is launched once per frame, after every sink using it has been written.
+	 * @param InCallbackFunc -  [optional] function which will be launched when timeline reaches end. Can be:
+	 *	[](float CurrentValue, float CurrentTime, bool bStoppped) -> void.
+	 *	[](float CurrentValue, float CurrentTime) -> void.
+	 * @param InBlendFunc -     [optional] a function used to update timeline. By default it is Linear.
+	 * @param InBlendExp -      [optional] an exponent, used by certain blend functions (EaseIn, EaseOut, EaseInOut) to control the shape of the timeline curve.
+	 * @param Settings [optional] - an extra settings to apply to this action.
+	 */
+	static FECFHandle AddTimelineSink(const UObject* InOwner, float InStartValue, float InStopValue, float InTime, const FECFTimelineSink& InSink, TUniqueFunction<void(float/* Value*/, float/* Time*/, bool/* bStopped*/)>&& InCallbackFunc = nullptr, EECFBlendFunc InBlendFunc = EECFBlendFunc::ECFBlend_Linear, float InBlendExp = 1.f, const FECFActionSettings& Settings = {});
+	static FECFHandle AddTimelineSink(const UObject* InOwner, float InStartValue, float InStopValue, float InTime, const FECFTimelineSink& InSink, TUniqueFunction<void(float/* Value*/, float/* Time*/)>&& InCallbackFunc, EECFBlendFunc InBlendFunc = EECFBlendFunc::ECFBlend_Linear, float InBlendExp = 1.f, const FECFActionSettings& Settings = {});
+
 	/**
 	 * Stops timelines. Will not launch callback functions.
 	 * @param bComplete			 - indicates if the action should be completed when stopped (run callback), or simply stopped.
@@ -289,6 +360,30 @@ public:
 
 	static void RemoveAllTimelinesLinearColor(const UObject* WorldContextObject, bool bComplete = false, UObject* InOwner = nullptr);
 
+	/*^^^ Typed Timeline ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^*/
+
+	/**
+	 * Adds a simple timeline of any value type that runs in a given range during a given time.
+	 * Supports every type that can be used with FMath::Lerp (e.g. FRotator) and the types with dedicated
+	 * TECFTimelineTraits specialization (FQuat, FTransform, TArray<float>).
+	 * The value type must be given explicitly, e.g. FFlow::AddTypedTimeline<FRotator>(...).
+	 * @param InStartValue -    the value from which this timeline will start.
+	 * @param InStopValue -     the value to which this timeline will go. Must be different than InStartValue.
+	 * @param InTime -          how long the timeline will be processed? Must be greater than 0.
+	 * @param InTickFunc -      ticking function executed when timeline is processed. It's param represents current value. Must be: [](const T& CurrentValue, float CurrentTime) -> void.
+	 * @param InCallbackFunc -  [optional] function which will be launched when timeline reaches end. Must be: [](const T& CurrentValue, float CurrentTime, bool bStoppped) -> void.
+	 * @param InBlendFunc -     [optional] a function used to update timeline. By default it is Linear.
+	 * @param InBlendExp -      [optional] an exponent, used by certain blend functions (EaseIn, EaseOut, EaseInOut) to control the shape of the timeline curve.
+	 * @param Settings [optional] - an extra settings to apply to this action.
+	 */
+	template<typename T>
+	static FECFHandle AddTypedTimeline(const UObject* InOwner, const T& InStartValue, const T& InStopValue, float InTime, TUniqueFunction<void(const T&/* Value*/, float/* Time*/)>&& InTickFunc, TUniqueFunction<void(const T&/* Value*/, float/* Time*/, bool/* bStopped*/)>&& InCallbackFunc = nullptr, EECFBlendFunc InBlendFunc = EECFBlendFunc::ECFBlend_Linear, float InBlendExp = 1.f, const FECFActionSettings& Settings = {})
+	{
+		return StartTypedTimeline(InOwner, MakeUnique<TECFTypedTimeline<T>>(InStartValue, InStopValue, InTime, MoveTemp(InTickFunc), MoveTemp(InCallbackFunc), InBlendFunc, InBlendExp), Settings);
+	}
+
+	static void RemoveAllTypedTimelines(const UObject* WorldContextObject, bool bComplete = false, UObject* InOwner = nullptr);
+
 	/*^^^ Custom Timeline ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^*/
 
 	/**
@@ -435,22 +530,144 @@ public:
 	 *	Can be: []() -> void.
 	 * @param InTimeOut				- if greater than 0.f it will apply timeout to this action. After this time the CallbackFunc will be called with a bTimedOut parameter set to true.
 	 *								  Have in mind, that the timeout will not stop the running async thread, it just won't trigger callback when the async task ends. Handle timeout on the side of the async task itself.
-	 * @param InThreadPriority		- thread priority (can be Normal or HiPriority).
+	 * @param InExecutor		- where the task runs. Can be a thread priority (Normal or HiPriority) or an FECFAsyncExecutor (tasks system, thread pool or pipe).
 	 * @param Settings [optional]	- an extra settings to apply to this action.
 	 */
-	static FECFHandle RunAsyncThen(const UObject* InOwner, TUniqueFunction<void()>&& InAsyncTaskFunc, TUniqueFunction<void(bool/* bTimedOut*/, bool/* bStopped*/)>&& InCallbackFunc, float InTimeOut = 0.f, EECFAsyncPrio InThreadPriority = EECFAsyncPrio::Normal, const FECFActionSettings& Settings = {});
-	static FECFHandle RunAsyncThen(const UObject* InOwner, TUniqueFunction<void()>&& InAsyncTaskFunc, TUniqueFunction<void(bool/* bStopped*/)>&& InCallbackFunc, float InTimeOut = 0.f, EECFAsyncPrio InThreadPriority = EECFAsyncPrio::Normal, const FECFActionSettings& Settings = {});
-	static FECFHandle RunAsyncThen(const UObject* InOwner, TUniqueFunction<void()>&& InAsyncTaskFunc, TUniqueFunction<void()>&& InCallbackFunc, float InTimeOut = 0.f, EECFAsyncPrio InThreadPriority = EECFAsyncPrio::Normal, const FECFActionSettings& Settings = {});
+	static FECFHandle RunAsyncThen(const UObject* InOwner, TUniqueFunction<void()>&& InAsyncTaskFunc, TUniqueFunction<void(bool/* bTimedOut*/, bool/* bStopped*/)>&& InCallbackFunc, float InTimeOut = 0.f, const FECFAsyncExecutor& InExecutor = EECFAsyncPrio::Normal, const FECFActionSettings& Settings = {});
+	static FECFHandle RunAsyncThen(const UObject* InOwner, TUniqueFunction<void()>&& InAsyncTaskFunc, TUniqueFunction<void(bool/* bStopped*/)>&& InCallbackFunc, float InTimeOut = 0.f, const FECFAsyncExecutor& InExecutor = EECFAsyncPrio::Normal, const FECFActionSettings& Settings = {});
+	static FECFHandle RunAsyncThen(const UObject* InOwner, TUniqueFunction<void()>&& InAsyncTaskFunc, TUniqueFunction<void()>&& InCallbackFunc, float InTimeOut = 0.f, const FECFAsyncExecutor& InExecutor = EECFAsyncPrio::Normal, const FECFActionSettings& Settings = {});
+
+	/**
+	 * The same as the above, but the task function receives a cancellation token. 
+	 * The token is cancelled when the action is stopped, times out or it's owner is no longer valid.
+	 * Long running tasks should check it and return early. Must be: [](const FECFCancellationToken& Token) -> void.
+	 */
+	static FECFHandle RunAsyncThen(const UObject* InOwner, TUniqueFunction<void(const FECFCancellationToken&/* Token*/)>&& InAsyncTaskFunc, TUniqueFunction<void(bool/* bTimedOut*/, bool/* bStopped*/)>&& InCallbackFunc, float InTimeOut = 0.f, const FECFAsyncExecutor& InExecutor = EECFAsyncPrio::Normal, const FECFActionSettings& Settings = {});
+	static FECFHandle RunAsyncThen(const UObject* InOwner, TUniqueFunction<void(const FECFCancellationToken&/* Token*/)>&& InAsyncTaskFunc, TUniqueFunction<void(bool/* bStopped*/)>&& InCallbackFunc, float InTimeOut = 0.f, const FECFAsyncExecutor& InExecutor = EECFAsyncPrio::Normal, const FECFActionSettings& Settings = {});
+	static FECFHandle RunAsyncThen(const UObject* InOwner, TUniqueFunction<void(const FECFCancellationToken&/* Token*/)>&& InAsyncTaskFunc, TUniqueFunction<void()>&& InCallbackFunc, float InTimeOut = 0.f, const FECFAsyncExecutor& InExecutor = EECFAsyncPrio::Normal, const FECFActionSettings& Settings = {});
+
+	/**
+	 * Runs the given task function on a separate thread and moves it's result to the callback function when this task ends.
+	 * The result type must be given explicitly, e.g. FFlow::RunAsyncThen<FMyResult>(...). Move-only types are supported.
+	 * @param InAsyncTaskFunc		- a task that will be running on a separate thread. Must be: []() -> TResult.
+	 * @param InCallbackFunc		- a callback with action to execute when the async task ends. The result is not set if the action has timed out
+	 *								  or has been stopped before the task ended. Must be: [](TOptional<TResult>&& Result, bool bTimedOut, bool bStopped) -> void.
+	 * @param InTimeOut				- if greater than 0.f it will apply timeout to this action. After this time the CallbackFunc will be called with a bTimedOut parameter set to true.
+	 * @param InExecutor		- where the task runs. Can be a thread priority (Normal or HiPriority) or an FECFAsyncExecutor (tasks system, thread pool or pipe).
+	 * @param Settings [optional]	- an extra settings to apply to this action.
+	 */
+	template<typename TResult>
+	static FECFHandle RunAsyncThen(const UObject* InOwner, TUniqueFunction<TResult()>&& InAsyncTaskFunc, TUniqueFunction<void(TOptional<TResult>&&/* Result*/, bool/* bTimedOut*/, bool/* bStopped*/)>&& InCallbackFunc, float InTimeOut = 0.f, const FECFAsyncExecutor& InExecutor = EECFAsyncPrio::Normal, const FECFActionSettings& Settings = {})
+	{
+		return RunAsyncThen<TResult>(InOwner, FECFCancellationToken::AdaptTaskFunc(MoveTemp(InAsyncTaskFunc)), MoveTemp(InCallbackFunc), InTimeOut, InExecutor, Settings);
+	}
+
+	// The same as the above, but the task function receives a cancellation token. Must be: [](const FECFCancellationToken& Token) -> TResult.
+	template<typename TResult>
+	static FECFHandle RunAsyncThen(const UObject* InOwner, TUniqueFunction<TResult(const FECFCancellationToken&/* Token*/)>&& InAsyncTaskFunc, TUniqueFunction<void(TOptional<TResult>&&/* Result*/, bool/* bTimedOut*/, bool/* bStopped*/)>&& InCallbackFunc, float InTimeOut = 0.f, const FECFAsyncExecutor& InExecutor = EECFAsyncPrio::Normal, const FECFActionSettings& Settings = {})
+	{
+		if (InAsyncTaskFunc && InCallbackFunc)
+		{
+			TSharedRef<TECFAsyncResult<TResult>, ESPMode::ThreadSafe> AsyncResult = MakeShared<TECFAsyncResult<TResult>, ESPMode::ThreadSafe>(MoveTemp(InAsyncTaskFunc));
+			return RunAsyncThen(InOwner, [AsyncResult](const FECFCancellationToken& Token)
+			{
+				AsyncResult->Run(Token);
+			},
+			[AsyncResult, CallbackFunc = MoveTemp(InCallbackFunc)](bool bTimedOut, bool bStopped)
+			{
+				CallbackFunc(AsyncResult->ConsumeResult(), bTimedOut, bStopped);
+			}, InTimeOut, InExecutor, Settings);
+		}
+		else
+		{
+			ensureMsgf(false, TEXT("ECF - Run Async Task and Run failed to start. Are you sure the AsyncTask and Function are set properly?"));
+			return FECFHandle();
+		}
+	}
 
 	/**
 	 * Stops Run Async Thens. Have in mind it will not stop running async threads. 
 	 * It will just forget about them and won't trigger callbacks when async tasks ends.
-	 * Handle stopping async tasks inside themselves.
+	 * Async tasks taking a cancellation token can check it to stop themselves.
 	 * @param InOwner [optional] - if defined it will remove time locks only from the given owner.
 	 *                             Otherwise it will remove all time locks from everywhere.
 	 */
 	static void RemoveAllRunAsyncThen(const UObject* WorldContextObject, UObject* InOwner = nullptr);
 
+	/*^^^ Run Async Batch ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^*/
+
+	/**
+	 * Runs the given function for every index from 0 to Count - 1 on worker threads and calls the callback function once, when all of them end.
+	 * Indices are split into chunks run by a parallel for, so the whole batch uses one action and one handle.
+	 * It is a Run Async Then underneath, so it can be stopped with RemoveAllRunAsyncThen.
+	 * @param InCount				- number of indices to run the function for.
+	 * @param InBatchFunc			- a function that will be running on worker threads. It can be called from many threads at once. Must be: [](int32 Index) -> void.
+	 * @param InCallbackFunc		- a callback with action to execute when all indices end. 
+	 *	Can be: [](bool bTimedOut, bool bStopped) -> void.
+	 *	Can be: [](bool bTimedOut) -> void.
+	 *	Can be: []() -> void.
+	 * @param InTimeOut				- if greater than 0.f it will apply timeout to this action. Indices which haven't started yet are skipped after the timeout.
+	 * @param InChunkSize			- number of indices run one after another by one worker. If 0 it will be chosen based on the number of worker threads.
+	 * @param InExecutor			- where the batch is launched. Can be a thread priority (Normal or HiPriority) or an FECFAsyncExecutor.
+	 * @param Settings [optional]	- an extra settings to apply to this action.
+	 */
+	static FECFHandle RunAsyncBatch(const UObject* InOwner, int32 InCount, TUniqueFunction<void(int32/* Index*/)>&& InBatchFunc, TUniqueFunction<void(bool/* bTimedOut*/, bool/* bStopped*/)>&& InCallbackFunc, float InTimeOut = 0.f, int32 InChunkSize = 0, const FECFAsyncExecutor& InExecutor = EECFAsyncPrio::Normal, const FECFActionSettings& Settings = {});
+	static FECFHandle RunAsyncBatch(const UObject* InOwner, int32 InCount, TUniqueFunction<void(int32/* Index*/)>&& InBatchFunc, TUniqueFunction<void(bool/* bTimedOut*/)>&& InCallbackFunc, float InTimeOut = 0.f, int32 InChunkSize = 0, const FECFAsyncExecutor& InExecutor = EECFAsyncPrio::Normal, const FECFActionSettings& Settings = {});
+	static FECFHandle RunAsyncBatch(const UObject* InOwner, int32 InCount, TUniqueFunction<void(int32/* Index*/)>&& InBatchFunc, TUniqueFunction<void()>&& InCallbackFunc, float InTimeOut = 0.f, int32 InChunkSize = 0, const FECFAsyncExecutor& InExecutor = EECFAsyncPrio::Normal, const FECFActionSettings& Settings = {});
+
+	/*^^^ Run Async Graph ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^*/
+
+	/**
+	 * Runs the given graph of async stages and calls the callback function when all stages end.
+	 * Stages start on worker threads right after their prerequisites end, only the callback runs on the game thread.
+	 * @param InGraph				- a graph of stages to run. See FECFAsyncGraph::AddStage.
+	 * @param InCallbackFunc		- a callback with action to execute when all stages end. 
+	 *	Can be: [](bool bTimedOut, bool bStopped) -> void.
+	 *	Can be: [](bool bTimedOut) -> void.
+	 *	Can be: []() -> void.
+	 * @param InTimeOut				- if greater than 0.f it will apply timeout to this action. After this time the CallbackFunc will be called with a bTimedOut parameter set to true.
+	 *								  Stages which haven't started yet are skipped and the running ones can check the cancellation token.
+	 * @param Settings [optional]	- an extra settings to apply to this action.
+	 */
+	static FECFHandle RunAsyncGraph(const UObject* InOwner, FECFAsyncGraph&& InGraph, TUniqueFunction<void(bool/* bTimedOut*/, bool/* bStopped*/)>&& InCallbackFunc, float InTimeOut = 0.f, const FECFActionSettings& Settings = {});
+	static FECFHandle RunAsyncGraph(const UObject* InOwner, FECFAsyncGraph&& InGraph, TUniqueFunction<void(bool/* bTimedOut*/)>&& InCallbackFunc, float InTimeOut = 0.f, const FECFActionSettings& Settings = {});
+	static FECFHandle RunAsyncGraph(const UObject* InOwner, FECFAsyncGraph&& InGraph, TUniqueFunction<void()>&& InCallbackFunc, float InTimeOut = 0.f, const FECFActionSettings& Settings = {});
+
+	/**
+	 * Stops Run Async Graphs. Stages which haven't started yet are skipped and callbacks won't be triggered.
+	 * @param InOwner [optional] - if defined it will remove graphs only from the given owner.
+	 *                             Otherwise it will remove all graphs from everywhere.
+	 */
+	static void RemoveAllRunAsyncGraphs(const UObject* WorldContextObject, UObject* InOwner = nullptr);
+
+	/*^^^ Coroutines Control ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^*/
+
+	/**
+	 * Starts the coroutine returned by the given function and returns a handle to it.
+	 * The coroutine is destroyed in the next tick after it's owner is destroyed, no matter what it awaits.
+	 * @param InCoroutineFunc - a function starting the coroutine. Must be: [this]() -> FECFCoroutine { return MyCoroutine(); }
+	 */
+	static FECFHandle StartCoroutine(const UObject* InOwner, TUniqueFunction<FECFCoroutine()>&& InCoroutineFunc);
+
+	/**
+	 * Checks if the coroutine started with StartCoroutine is still running.
+	 */
+	static bool IsCoroutineRunning(const UObject* WorldContextObject, const FECFHandle& Handle);
+
+	/**
+	 * Stops the coroutine started with StartCoroutine and destroys it's frame. Invalidates given handle.
+	 * It must not be called from inside the coroutine being stopped.
+	 */
+	static void StopCoroutine(const UObject* WorldContextObject, FECFHandle& Handle);
+
+	/**
+	 * Stops coroutines and destroys their frames. It covers coroutines started with StartCoroutine
+	 * and coroutines suspended by ECF coroutine actions.
+	 * It must not be called from inside any of the coroutines being stopped.
+	 * @param InOwner [optional] - if defined it will stop coroutines only from the given owner. Otherwise
+	 *                             it will stop coroutines from everywhere.
+	 */
+	static void StopAllCoroutines(const UObject* WorldContextObject, UObject* InOwner = nullptr);
 
 	/*^^^ Wait Seconds (Coroutine) ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^*/
 
@@ -488,6 +705,34 @@ public:
 	 */
 	static void RemoveAllWaitTicks(const UObject* WorldContextObject, bool bComplete = false, UObject* InOwner = nullptr);
 
+	/*^^^ Yield And Time Slicing (Coroutine) ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^*/
+
+	/**
+	 * Gives the control back to the subsystem. The coroutine is resumed in the next frame, or in a later one
+	 * if coroutines resumed before it have spent the yield budget of the frame (ECF.CoroutineYieldBudget).
+	 * Can be used with co_yield or co_await, e.g. if (Slice.ShouldYield()) co_yield FFlow::YieldCoroutine(this);
+	 */
+	static FECFCoroutineAwaiter_Yield YieldCoroutine(const UObject* InOwner);
+
+	/**
+	 * Runs the given function for every index from 0 to InCount - 1, yielding to the next frame every time
+	 * the time budget is spent. The amount of iterations between time checks adapts to the cost of an iteration.
+	 * Must be awaited, e.g. co_await FFlow::TimeSlicedFor(this, Actors.Num(), 2.f, [this](int32 Index) { ... });
+	 * @param InCount		- the amount of iterations.
+	 * @param InBudgetMs	- time in milliseconds the loop can take in one frame.
+	 * @param InBody		- a function run for every index. Must be: [](int32 Index) -> void.
+	 */
+	[[nodiscard]] static TECFTask<> TimeSlicedFor(const UObject* InOwner, int32 InCount, float InBudgetMs, TUniqueFunction<void(int32/* Index*/)> InBody);
+
+	/**
+	 * Stops all yielded coroutines. 
+	 * @param bComplete			 - indicates if the coroutines should be resumed when stopped, or simply stopped.
+	 *							   !!!Have in mind that not completed coroutine will suspend function forever!!!
+	 * @param InOwner [optional] - if defined it will remove yielded coroutines only from the given owner. Otherwise
+	 *                             it will remove yielded coroutines from everywhere.
+	 */
+	static void RemoveAllYields(const UObject* WorldContextObject, bool bComplete = false, UObject* InOwner = nullptr);
+
 	/*^^^ Wait Until (Coroutine) ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^*/
 	
 	/**
@@ -517,7 +762,36 @@ public:
 	 * @param InTimeOut				- if greater than 0.f it will apply timeout to this action. After this timeout the suspended function will be resumed.
 	 * @param Settings [optional]	- an extra settings to apply to this action.
 	 */
-	static FECFCoroutineAwaiter_RunAsyncAndWait RunAsyncAndWait(const UObject* InOwner, TUniqueFunction<void()>&& InAsyncTaskFunc, float InTimeOut = 0.f, EECFAsyncPrio InThreadPriority = EECFAsyncPrio::Normal, const FECFActionSettings& Settings = {});
+	static FECFCoroutineAwaiter_RunAsyncAndWait RunAsyncAndWait(const UObject* InOwner, TUniqueFunction<void()>&& InAsyncTaskFunc, float InTimeOut = 0.f, const FECFAsyncExecutor& InExecutor = EECFAsyncPrio::Normal, const FECFActionSettings& Settings = {});
+
+	/**
+	 * The same as the above, but the task function receives a cancellation token. 
+	 * The token is cancelled when the action is stopped, times out or it's owner is no longer valid.
+	 * Long running tasks should check it and return early. Must be: [](const FECFCancellationToken& Token) -> void.
+	 */
+	static FECFCoroutineAwaiter_RunAsyncAndWait RunAsyncAndWait(const UObject* InOwner, TUniqueFunction<void(const FECFCancellationToken&/* Token*/)>&& InAsyncTaskFunc, float InTimeOut = 0.f, const FECFAsyncExecutor& InExecutor = EECFAsyncPrio::Normal, const FECFActionSettings& Settings = {});
+
+	/**
+	 * Runs the given task function on a separate thread and suspends running coroutine function until this task ends.
+	 * co_await returns the result of the task. The result is not set if the action has timed out.
+	 * The result type must be given explicitly, e.g. co_await FFlow::RunAsyncAndWait<FMyResult>(...). Move-only types are supported.
+	 * @param InAsyncTaskFunc		- a task that will be running on a separate thread. Must be: []() -> TResult.
+	 * @param InTimeOut				- if greater than 0.f it will apply timeout to this action. After this timeout the suspended function will be resumed.
+	 * @param InExecutor		- where the task runs. Can be a thread priority (Normal or HiPriority) or an FECFAsyncExecutor (tasks system, thread pool or pipe).
+	 * @param Settings [optional]	- an extra settings to apply to this action.
+	 */
+	template<typename TResult>
+	static TECFCoroutineAwaiter_RunAsyncAndWait<TResult> RunAsyncAndWait(const UObject* InOwner, TUniqueFunction<TResult()>&& InAsyncTaskFunc, float InTimeOut = 0.f, const FECFAsyncExecutor& InExecutor = EECFAsyncPrio::Normal, const FECFActionSettings& Settings = {})
+	{
+		return RunAsyncAndWait<TResult>(InOwner, FECFCancellationToken::AdaptTaskFunc(MoveTemp(InAsyncTaskFunc)), InTimeOut, InExecutor, Settings);
+	}
+
+	// The same as the above, but the task function receives a cancellation token. Must be: [](const FECFCancellationToken& Token) -> TResult.
+	template<typename TResult>
+	static TECFCoroutineAwaiter_RunAsyncAndWait<TResult> RunAsyncAndWait(const UObject* InOwner, TUniqueFunction<TResult(const FECFCancellationToken&/* Token*/)>&& InAsyncTaskFunc, float InTimeOut = 0.f, const FECFAsyncExecutor& InExecutor = EECFAsyncPrio::Normal, const FECFActionSettings& Settings = {})
+	{
+		return TECFCoroutineAwaiter_RunAsyncAndWait<TResult>(InOwner, Settings, MakeShared<TECFAsyncResult<TResult>, ESPMode::ThreadSafe>(MoveTemp(InAsyncTaskFunc)), InTimeOut, InExecutor);
+	}
 
 	/**
 	 * Stops all Wait Until coroutine actions.
@@ -527,6 +801,121 @@ public:
 	 *                             it will remove Wait Until actions from everywhere.
 	 */
 	static void RemoveAllRunAsyncAndWait(const UObject* WorldContextObject, bool bComplete = false, UObject* InOwner = nullptr);
+
+	/*^^^ Resume On Background / Game Thread (Coroutine) ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^*/
+
+	/**
+	 * Moves the running coroutine function to a worker thread. Everything after it runs on the worker,
+	 * until the coroutine moves back with ResumeOnGameThread. Can be used only in FECFCoroutine functions.
+	 * !!!Other ECF coroutines and UObjects can't be used on the worker thread!!!
+	 * !!!Coroutines started with StartCoroutine must move back to the Game Thread before they end!!!
+	 * If the coroutine is stopped or it's owner is destroyed while it runs on the worker thread,
+	 * it is destroyed when it moves back to the Game Thread.
+	 * @param InExecutor		- where the coroutine runs. Can be a thread priority (Normal or HiPriority) or an FECFAsyncExecutor (tasks system, thread pool or pipe).
+	 */
+	static FECFCoroutineAwaiter_ResumeOnBackground ResumeOnBackground(const UObject* InOwner, const FECFAsyncExecutor& InExecutor = EECFAsyncPrio::Normal);
+
+	/**
+	 * Moves the coroutine function running on a worker thread back to the Game Thread. It is resumed as soon as
+	 * the Game Thread processes it's tasks, without waiting for the ECF subsystem tick.
+	 */
+	static FECFCoroutineAwaiter_ResumeOnGameThread ResumeOnGameThread();
+
+	/*^^^ Wait For Delegate (Coroutine) ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^*/
+
+	/**
+	 * Suspends running coroutine function until the given multicast delegate fires. The coroutine is resumed
+	 * right away, inside the delegate's broadcast, and the action doesn't tick at all while waiting (unless the timeout is set).
+	 * co_await returns true if the coroutine has been resumed because of the timeout.
+	 * Works with native (DECLARE_MULTICAST_DELEGATE, DECLARE_EVENT) and dynamic (DECLARE_DYNAMIC_MULTICAST_DELEGATE) multicast delegates
+	 * of any signature. The delegate parameters are ignored.
+	 * !!!The delegate must stay alive until the coroutine is resumed or the action is stopped!!!
+	 * @param InDelegate			- a multicast delegate to wait for.
+	 * @param InTimeOut				- if greater than 0.f it will apply timeout to this action. After this timeout the suspended function will be resumed.
+	 * @param Settings [optional]	- an extra settings to apply to this action.
+	 */
+	template<typename TDelegate>
+	static FECFCoroutineAwaiter_WaitForDelegate WaitForDelegate(const UObject* InOwner, TDelegate& InDelegate, float InTimeOut = 0.f, const FECFActionSettings& Settings = {})
+	{
+		return FECFCoroutineAwaiter_WaitForDelegate(InOwner, Settings, MakeUnique<TECFDelegateBinding<TDelegate>>(InDelegate, nullptr), InTimeOut);
+	}
+
+	/**
+	 * The same as the above, but the delegate is a member of the given InDelegateOwner object.
+	 * The delegate can be destroyed together with it's owner before the coroutine is resumed. The action won't touch it anymore then.
+	 * @param InDelegateOwner		- an object owning the delegate.
+	 */
+	template<typename TDelegate>
+	static FECFCoroutineAwaiter_WaitForDelegate WaitForDelegate(const UObject* InOwner, const UObject* InDelegateOwner, TDelegate& InDelegate, float InTimeOut = 0.f, const FECFActionSettings& Settings = {})
+	{
+		return FECFCoroutineAwaiter_WaitForDelegate(InOwner, Settings, MakeUnique<TECFDelegateBinding<TDelegate>>(InDelegate, InDelegateOwner), InTimeOut);
+	}
+
+	/**
+	 * Stops all Wait For Delegate coroutine actions.
+	 * @param bComplete			 - indicates if the action should be completed when stopped (run callback), or simply stopped.
+	 *							   !!!Have in mind that not completed coroutine will suspend function forever!!!
+	 * @param InOwner [optional] - if defined it will remove Wait For Delegate actions only from the given owner. Otherwise
+	 *                             it will remove Wait For Delegate actions from everywhere.
+	 */
+	static void RemoveAllWaitForDelegate(const UObject* WorldContextObject, bool bComplete = false, UObject* InOwner = nullptr);
+
+	/*^^^ When All / When Any (Coroutine) ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^*/
+
+	/**
+	 * Suspends running coroutine function until all of the given coroutine awaiters end.
+	 * All awaiters are driven by one action. Their own owners and settings are not used.
+	 * Supported awaiters: WaitSeconds, WaitTicks, WaitUntil and RunAsyncAndWait (results of typed RunAsyncAndWait are not passed).
+	 * @param InAwaiters			- awaiters to wait for, e.g. FFlow::WaitSeconds(this, 1.f).
+	 */
+	template<typename ... TAwaiters>
+	static FECFCoroutineAwaiter_WhenAllAny WhenAll(const UObject* InOwner, TAwaiters&& ... InAwaiters)
+	{
+		return MakeWhenAllAny(InOwner, true, InAwaiters...);
+	}
+
+	/**
+	 * Suspends running coroutine function until any of the given coroutine awaiters ends. The rest of them are cancelled.
+	 * co_await returns the index of the awaiter which has ended first (INDEX_NONE if the action has been stopped).
+	 * All awaiters are driven by one action. Their own owners and settings are not used.
+	 * Supported awaiters: WaitSeconds, WaitTicks, WaitUntil and RunAsyncAndWait (results of typed RunAsyncAndWait are not passed).
+	 * @param InAwaiters			- awaiters to wait for, e.g. FFlow::WaitSeconds(this, 1.f).
+	 */
+	template<typename ... TAwaiters>
+	static FECFCoroutineAwaiter_WhenAllAny WhenAny(const UObject* InOwner, TAwaiters&& ... InAwaiters)
+	{
+		return MakeWhenAllAny(InOwner, false, InAwaiters...);
+	}
+
+	/**
+	 * Stops all When All and When Any coroutine actions.
+	 * @param bComplete			 - indicates if the action should be completed when stopped (run callback), or simply stopped.
+	 *							   !!!Have in mind that not completed coroutine will suspend function forever!!!
+	 * @param InOwner [optional] - if defined it will remove When All/Any actions only from the given owner. Otherwise
+	 *                             it will remove When All/Any actions from everywhere.
+	 */
+	static void RemoveAllWhenAllAny(const UObject* WorldContextObject, bool bComplete = false, UObject* InOwner = nullptr);
+
+private:
+
+	// Launches the already created typed timeline. Used by the AddTypedTimeline template.
+	static FECFHandle StartTypedTimeline(const UObject* InOwner, TUniquePtr<FECFTypedTimelineBase>&& InTimeline, const FECFActionSettings& Settings);
+
+	// Checks if the batch can be started. Used by RunAsyncBatch.
+	static bool IsBatchValid(int32 InCount, const TUniqueFunction<void(int32)>& InBatchFunc);
+
+	// Wraps the batch function into an async task running it in a chunked parallel for. Used by RunAsyncBatch.
+	static TUniqueFunction<void(const FECFCancellationToken&)> MakeBatchTask(int32 InCount, TUniqueFunction<void(int32)>&& InBatchFunc, int32 InChunkSize);
+
+	// Moves conditions out of the given awaiters into one When All/Any awaiter.
+	template<typename ... TAwaiters>
+	static FECFCoroutineAwaiter_WhenAllAny MakeWhenAllAny(const UObject* InOwner, bool bWaitForAll, TAwaiters& ... InAwaiters)
+	{
+		TArray<TUniquePtr<FECFWaitCondition>> Conditions;
+		Conditions.Reserve(sizeof...(TAwaiters));
+		(Conditions.Add(InAwaiters.MakeCondition()), ...);
+		return FECFCoroutineAwaiter_WhenAllAny(InOwner, {}, MoveTemp(Conditions), bWaitForAll);
+	}
 };
 
 using FFlow = FEnhancedCodeFlow;
\ No newline at end of file